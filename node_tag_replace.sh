@@ -1,8 +1,12 @@
 #!/usr/bin/env bash
 #
-# rename_tag.sh  –  safe, project-wide search-and-replace for node tags
+# node_tag_replace.sh  –  rename a node tag in the world description
 #
-# usage:  ./rename_tag.sh OLD_TAG NEW_TAG
+# usage:  ./node_tag_replace.sh OLD_TAG NEW_TAG
+#
+# Tags only exist in world/*.world; the game finds nodes by idstr, the tag
+# with '_' as '-' (MAIN_MENU is MAIN-MENU). Renaming a tag renames its idstr
+# too, so saves made in that scene will no longer load.
 #
 
 set -euo pipefail
@@ -15,13 +19,18 @@ fi
 
 old=$1
 new=$2
-#!/bin/bash
 
 # Protect against trivial foot-guns
 if [[ $old == "$new" ]]; then
     echo "Old tag and new tag are identical; nothing to do." >&2
     exit 0
 fi
+if [[ ! $new =~ ^[A-Za-z0-9_]+$ ]]; then
+    echo "'$new' is not a valid tag: use letters, digits and '_'." >&2
+    exit 1
+fi
+
+cd "$(dirname "$0")"
 
 # Warn if working tree is dirty (git users)
 if command -v git >/dev/null && git rev-parse --is-inside-work-tree &>/dev/null; then
@@ -33,27 +42,28 @@ if command -v git >/dev/null && git rev-parse --is-inside-work-tree &>/dev/null;
 fi
 
 ########## 2. pick the files to touch ##########################################
-# Edit only text-like project files; avoid .git, build output, binaries, etc.
-# Adjust the find(1) expression to match your layout if needed.
-mapfile -t files < <(
-  grep -RIl --exclude-dir={.git,build,obj} -e "$old" .
-)
+mapfile -t files < <(grep -lw -e "$old" world/*.world || true)
 
 if (( ${#files[@]} == 0 )); then
-    echo "No occurrences of '$old' found." >&2
+    echo "No occurrences of '$old' found in world/." >&2
     exit 0
 fi
+if grep -qw -e "$new" world/*.world; then
+    echo "'$new' is already a tag in world/; refusing to merge two nodes." >&2
+    exit 1
+fi
 
 ########## 3. replace in-place with backup #####################################
 for f in "${files[@]}"; do
-    # Make a .bak copy (so you can diff/undo easily)
     cp -- "$f" "$f.bak"
-
-    # Word-boundary replacement; change to plain s///g if you sometimes embed tags
     sed -i "s/\b${old}\b/${new}/g" -- "$f"
 done
 
 ########## 4. report ###########################################################
-echo "Replaced '$old' → '$new' in ${#files[@]} files."
-echo "Backups retained with .bak suffix."
-echo "Review the changes (git diff / meld / diff -u *.bak) and then remove .bak files when satisfied."
+echo "Replaced '$old' → '$new' in ${#files[@]} files. Backups retained with .bak suffix."
+old_id=$(tr '_a-z' '-A-Z' <<< "$old")
+if grep -rqF -- "\"$old_id\"" src tools; then
+    echo "⚠️  The code looks '$old_id' up by idstr; update it by hand:" >&2
+    grep -rnF -- "\"$old_id\"" src tools >&2
+fi
+echo "Run 'make world' to rebuild bin/odv9.wld."
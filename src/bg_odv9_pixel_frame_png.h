@@ -1,129 +0,0 @@
-unsigned char bg_odv9_pixel_frame_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xf0,
-  0x08, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x4f, 0x2a, 0x3c, 0x00, 0x00, 0x00,
-  0x01, 0x73, 0x52, 0x47, 0x42, 0x01, 0xd9, 0xc9, 0x2c, 0x7f, 0x00, 0x00,
-  0x00, 0x04, 0x67, 0x41, 0x4d, 0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc,
-  0x61, 0x05, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00,
-  0x7a, 0x26, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
-  0x80, 0xe8, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0xea, 0x60, 0x00, 0x00,
-  0x3a, 0x98, 0x00, 0x00, 0x17, 0x70, 0x9c, 0xba, 0x51, 0x3c, 0x00, 0x00,
-  0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13, 0x00, 0x00,
-  0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c, 0x18, 0x00, 0x00, 0x00, 0x07, 0x74,
-  0x49, 0x4d, 0x45, 0x07, 0xe9, 0x07, 0x06, 0x0e, 0x2c, 0x19, 0x3d, 0x10,
-  0x8d, 0x42, 0x00, 0x00, 0x05, 0x3a, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda,
-  0xed, 0xdb, 0xed, 0x4e, 0x22, 0x57, 0x18, 0xc0, 0xf1, 0x67, 0x5e, 0x78,
-  0x51, 0xaa, 0x49, 0xd7, 0xd8, 0xd0, 0x36, 0xd9, 0xec, 0x97, 0x5e, 0x45,
-  0x6f, 0xa0, 0xf7, 0x7f, 0x0f, 0x6d, 0xcc, 0x1a, 0x4d, 0x16, 0x3b, 0xca,
-  0xc0, 0xcc, 0x9c, 0x7e, 0xc0, 0x75, 0xb7, 0x0b, 0x28, 0x44, 0x10, 0x8d,
-  0xbf, 0xdf, 0x27, 0xa3, 0x03, 0x9c, 0x39, 0xc9, 0xc3, 0xff, 0x10, 0x76,
-  0xb3, 0x3f, 0xfe, 0xfc, 0x2b, 0x80, 0xb7, 0x29, 0xb7, 0x05, 0x60, 0x80,
-  0x81, 0x03, 0x28, 0x1f, 0xf9, 0x5b, 0x51, 0x94, 0x36, 0x08, 0x0e, 0xae,
-  0x6d, 0x9b, 0xed, 0x06, 0x78, 0x31, 0xba, 0x57, 0x97, 0x17, 0xf6, 0x0e,
-  0x0e, 0xee, 0xec, 0x7c, 0xbc, 0x6e, 0x8c, 0xcb, 0x95, 0xd3, 0xbb, 0x18,
-  0xdd, 0xbb, 0xdb, 0xca, 0xde, 0xc1, 0xc1, 0x2d, 0xe6, 0xf1, 0xec, 0x7c,
-  0xbc, 0x3c, 0xc3, 0xe5, 0xca, 0xe9, 0xbd, 0xbb, 0xad, 0x66, 0x55, 0xd5,
-  0xb5, 0x9d, 0xbd, 0x83, 0x83, 0x9b, 0x55, 0x55, 0x7f, 0x34, 0xba, 0xba,
-  0xbc, 0x58, 0x9e, 0xe1, 0xd5, 0x47, 0xe8, 0xe9, 0xe4, 0x66, 0x30, 0x3c,
-  0x8a, 0x5e, 0x44, 0xc4, 0x68, 0x34, 0x8a, 0x88, 0xc1, 0xf1, 0xb0, 0xbe,
-  0x9d, 0x0e, 0x8e, 0x87, 0x76, 0x13, 0xf6, 0x6a, 0x31, 0x68, 0xf5, 0xed,
-  0x34, 0x22, 0xaa, 0xaa, 0x7a, 0x18, 0xc9, 0xa3, 0xe3, 0xd1, 0x13, 0x47,
-  0xe8, 0x87, 0xfc, 0xde, 0xff, 0xad, 0xec, 0x0d, 0x06, 0xfd, 0xab, 0x69,
-  0x1d, 0x11, 0x3f, 0xd5, 0xb3, 0x88, 0xa8, 0xeb, 0x99, 0xfd, 0x85, 0xbd,
-  0xcf, 0x70, 0x3d, 0xfb, 0x37, 0xa5, 0x88, 0x38, 0x1b, 0x8d, 0xea, 0x7a,
-  0xd6, 0x34, 0xf3, 0xc5, 0x47, 0xda, 0xe5, 0x08, 0x97, 0xeb, 0xf2, 0xfb,
-  0x6d, 0x7a, 0x27, 0xd7, 0x6d, 0x9b, 0xbe, 0xa4, 0x14, 0x91, 0x45, 0x72,
-  0xa8, 0x86, 0x3d, 0xcb, 0xf2, 0x88, 0x14, 0x59, 0x56, 0x14, 0xd9, 0x55,
-  0x7c, 0x38, 0x1b, 0x0e, 0x22, 0x22, 0x86, 0xab, 0x23, 0xbc, 0xf6, 0x8b,
-  0xa2, 0x87, 0xe9, 0xcd, 0xcb, 0x5e, 0xee, 0xeb, 0x24, 0x38, 0x84, 0x6e,
-  0x72, 0xbd, 0x98, 0xe1, 0x45, 0x84, 0x9f, 0x38, 0x42, 0x7f, 0xfb, 0x6d,
-  0xd9, 0x5b, 0xfc, 0x90, 0x97, 0xbd, 0x88, 0xe8, 0x32, 0x3b, 0x09, 0x2f,
-  0x2d, 0x4f, 0x91, 0x97, 0xbd, 0xee, 0xeb, 0x48, 0xd6, 0x71, 0xb7, 0xe9,
-  0x00, 0xdf, 0x9b, 0x5c, 0x47, 0xd9, 0xeb, 0xca, 0xa3, 0x30, 0xc0, 0xf0,
-  0xf2, 0xf9, 0x4d, 0x91, 0x37, 0x77, 0x31, 0xb9, 0x8e, 0xe1, 0xaf, 0xeb,
-  0xae, 0xd9, 0xf8, 0x70, 0x9c, 0xec, 0x27, 0xbc, 0xe4, 0x27, 0xe1, 0x8d,
-  0xae, 0xda, 0xee, 0xd3, 0x6d, 0x56, 0x14, 0x36, 0x16, 0xf6, 0x2a, 0xb5,
-  0xed, 0x16, 0xc7, 0x6c, 0xd3, 0x0b, 0xaf, 0x2b, 0xbd, 0xdb, 0x0c, 0x9a,
-  0xff, 0x8d, 0x04, 0x6f, 0xd8, 0xd6, 0x5f, 0x10, 0x65, 0x45, 0xcf, 0xae,
-  0xc1, 0xde, 0xce, 0xcf, 0xf3, 0xfd, 0x0e, 0xf0, 0xb6, 0x2f, 0x00, 0x28,
-  0x30, 0x28, 0xb0, 0x02, 0x83, 0x02, 0xdb, 0x35, 0x50, 0x60, 0x40, 0x81,
-  0x41, 0x81, 0x15, 0x18, 0x14, 0x18, 0x50, 0x60, 0x40, 0x81, 0x41, 0x81,
-  0x15, 0x18, 0x14, 0x18, 0x50, 0x60, 0x40, 0x81, 0x41, 0x81, 0x01, 0x05,
-  0x06, 0x14, 0x18, 0x14, 0x58, 0x81, 0x41, 0x81, 0x01, 0x05, 0x06, 0x05,
-  0x56, 0x60, 0x50, 0x60, 0x05, 0x06, 0x05, 0x06, 0x14, 0x18, 0x14, 0x58,
-  0x81, 0x41, 0x81, 0x01, 0x05, 0x06, 0x14, 0x18, 0x14, 0x58, 0x81, 0x41,
-  0x81, 0x01, 0x05, 0x06, 0x14, 0x18, 0x14, 0x58, 0x81, 0x41, 0x81, 0x01,
-  0x05, 0x06, 0x05, 0x56, 0x60, 0x50, 0x60, 0x40, 0x81, 0x41, 0x81, 0x15,
-  0x18, 0x14, 0x58, 0x81, 0x41, 0x81, 0x01, 0x05, 0x06, 0x05, 0x56, 0x60,
-  0x50, 0x60, 0x40, 0x81, 0x01, 0x05, 0x06, 0x05, 0x56, 0x60, 0x50, 0x60,
-  0x40, 0x81, 0x01, 0x05, 0x06, 0x05, 0x56, 0x60, 0x50, 0x60, 0x40, 0x81,
-  0x01, 0x05, 0x06, 0x05, 0x06, 0x14, 0x18, 0x50, 0x60, 0x50, 0x60, 0x05,
-  0x06, 0x05, 0x06, 0x14, 0x18, 0x14, 0x58, 0x81, 0x41, 0x81, 0x15, 0x18,
-  0x14, 0x18, 0x50, 0x60, 0x50, 0x60, 0x05, 0x06, 0x05, 0x06, 0x14, 0x18,
-  0x50, 0x60, 0x50, 0x60, 0x05, 0x06, 0x05, 0x06, 0x14, 0x18, 0x50, 0x60,
-  0x50, 0x60, 0x05, 0x06, 0x05, 0x06, 0x14, 0x18, 0x14, 0x58, 0x81, 0x41,
-  0x81, 0x01, 0x05, 0x06, 0x05, 0x56, 0x60, 0x50, 0x60, 0x05, 0x06, 0x05,
-  0x06, 0x14, 0x18, 0x14, 0x58, 0x81, 0x41, 0x81, 0x01, 0x05, 0x06, 0x14,
-  0x18, 0x14, 0x58, 0x81, 0x41, 0x81, 0x01, 0x05, 0x06, 0x14, 0x18, 0x14,
-  0x58, 0x81, 0x41, 0x81, 0x01, 0x05, 0x06, 0x14, 0x18, 0x14, 0x18, 0x50,
-  0x60, 0x40, 0x81, 0x41, 0x81, 0x15, 0x18, 0x14, 0x18, 0x50, 0x60, 0x50,
-  0x60, 0x05, 0x06, 0x05, 0x56, 0x60, 0x50, 0x60, 0x40, 0x81, 0x41, 0x81,
-  0x15, 0x18, 0x14, 0x18, 0x50, 0x60, 0x40, 0x81, 0x41, 0x81, 0x15, 0x18,
-  0x14, 0x18, 0x50, 0x60, 0x40, 0x81, 0x41, 0x81, 0x15, 0x18, 0x14, 0x18,
-  0x50, 0x60, 0x50, 0x60, 0x05, 0x06, 0x05, 0x06, 0x14, 0x18, 0x14, 0x58,
-  0x81, 0x41, 0x81, 0x15, 0x18, 0x14, 0x18, 0x50, 0x60, 0x50, 0x60, 0x05,
-  0x06, 0x05, 0x06, 0x14, 0x18, 0x50, 0x60, 0x50, 0x60, 0x05, 0x06, 0x05,
-  0x06, 0x14, 0x18, 0x50, 0x60, 0x50, 0x60, 0x05, 0x06, 0x05, 0x06, 0x14,
-  0x18, 0x50, 0x60, 0x50, 0x60, 0x40, 0x81, 0x01, 0x05, 0x06, 0x05, 0x56,
-  0x60, 0x50, 0x60, 0x40, 0x81, 0x41, 0x81, 0x15, 0x18, 0x14, 0x58, 0x81,
-  0x41, 0x81, 0x01, 0x05, 0x06, 0x05, 0x56, 0x60, 0x50, 0x60, 0x40, 0x81,
-  0x01, 0x05, 0x06, 0x05, 0x56, 0x60, 0x50, 0x60, 0x40, 0x81, 0x01, 0x05,
-  0x06, 0x05, 0x06, 0x14, 0x18, 0x50, 0x60, 0x50, 0x60, 0x05, 0x06, 0x05,
-  0x06, 0x14, 0x18, 0x14, 0x58, 0x81, 0x41, 0x81, 0x15, 0x18, 0x14, 0x18,
-  0x50, 0x60, 0x50, 0x60, 0x05, 0x06, 0x05, 0x06, 0x14, 0x18, 0x50, 0x60,
-  0x50, 0x60, 0x05, 0x06, 0x05, 0x06, 0x14, 0x18, 0x50, 0x60, 0x50, 0x60,
-  0x05, 0x06, 0x05, 0x06, 0x14, 0x18, 0x50, 0x60, 0x50, 0x60, 0x40, 0x81,
-  0x01, 0x05, 0x06, 0x05, 0x56, 0x60, 0x50, 0x60, 0x40, 0x81, 0x41, 0x81,
-  0x15, 0x18, 0x14, 0x58, 0x81, 0x41, 0x81, 0x01, 0x05, 0x06, 0x05, 0x56,
-  0x60, 0x50, 0x60, 0x40, 0x81, 0x01, 0x05, 0x06, 0x05, 0x56, 0x60, 0x50,
-  0x60, 0x40, 0x81, 0x01, 0x05, 0x06, 0x05, 0x06, 0x14, 0x18, 0x50, 0x60,
-  0x50, 0x60, 0x05, 0x06, 0x05, 0x06, 0x14, 0x18, 0x14, 0x58, 0x81, 0x41,
-  0x81, 0x15, 0x18, 0x14, 0x18, 0x50, 0x60, 0x50, 0x60, 0x05, 0x06, 0x05,
-  0x06, 0x14, 0x18, 0x50, 0x60, 0x78, 0x87, 0x05, 0xee, 0xba, 0x94, 0x65,
-  0x11, 0x29, 0xcb, 0xf2, 0xb5, 0x43, 0x9b, 0xb2, 0xb5, 0x2f, 0x90, 0x3d,
-  0xb2, 0x96, 0x5d, 0xdc, 0xd0, 0xb6, 0xcf, 0xff, 0xda, 0xd6, 0xf3, 0xde,
-  0xee, 0xd7, 0x7a, 0x76, 0xb1, 0x9e, 0x2c, 0xb2, 0x48, 0x91, 0x36, 0x58,
-  0x62, 0x1e, 0x79, 0x1e, 0x91, 0x1e, 0x7d, 0xe2, 0xaf, 0xda, 0x6e, 0x67,
-  0xf7, 0x16, 0x7b, 0xde, 0xbb, 0x37, 0xb1, 0x9e, 0xf7, 0x76, 0xbf, 0xd6,
-  0xb3, 0xe1, 0xf5, 0x9b, 0x0d, 0x5a, 0x4a, 0xdd, 0xf7, 0x47, 0xe8, 0x8d,
-  0x67, 0xb8, 0xc8, 0x77, 0xff, 0x36, 0x16, 0xbb, 0x7b, 0x9b, 0x7c, 0x6d,
-  0xeb, 0x79, 0x6f, 0xf7, 0x6b, 0x3d, 0xcf, 0xbc, 0x7e, 0xcb, 0x4c, 0x96,
-  0x6d, 0xd7, 0xe6, 0xd9, 0x36, 0xef, 0x15, 0x4b, 0x2f, 0x90, 0x76, 0xba,
-  0x49, 0xd9, 0xd2, 0xfb, 0xc8, 0xe3, 0xcf, 0xbf, 0xed, 0xf5, 0xfb, 0x5e,
-  0xcf, 0x7b, 0xbb, 0x5f, 0xeb, 0xd9, 0xed, 0x7a, 0xb2, 0x8d, 0xc3, 0xbd,
-  0xf8, 0xcc, 0x5b, 0x66, 0x91, 0xa7, 0x48, 0xab, 0x1f, 0x74, 0xfa, 0x21,
-  0x6e, 0x6f, 0xf2, 0x34, 0x4f, 0x59, 0xff, 0x99, 0x4b, 0xcc, 0x9e, 0x71,
-  0x5e, 0xd9, 0xc7, 0x96, 0xed, 0x7b, 0x3d, 0xef, 0xed, 0x7e, 0xad, 0x67,
-  0x1f, 0x23, 0x9d, 0xa7, 0xf9, 0xfd, 0x18, 0x3e, 0x52, 0xe0, 0x2c, 0x4f,
-  0x69, 0xe9, 0xe1, 0x4d, 0x33, 0x1f, 0x0c, 0xfa, 0x11, 0xd1, 0x35, 0xf3,
-  0x3c, 0x22, 0x2b, 0x7c, 0xd8, 0x71, 0xbf, 0xd6, 0xf3, 0xe2, 0xeb, 0x69,
-  0x9b, 0xae, 0x99, 0x3f, 0x8c, 0xe4, 0x9a, 0x01, 0x8e, 0xd5, 0x27, 0xe8,
-  0xba, 0x9e, 0x9d, 0xf4, 0x8a, 0xd1, 0xc7, 0x4f, 0x9f, 0xff, 0xf9, 0x3b,
-  0xda, 0x26, 0x80, 0x17, 0x37, 0xfe, 0xf8, 0xa9, 0xaa, 0xaa, 0xba, 0x9e,
-  0xad, 0x2d, 0xf0, 0xf2, 0xaf, 0x86, 0xa7, 0x27, 0xd3, 0xc9, 0x4d, 0x0c,
-  0xa3, 0x8c, 0x5e, 0x55, 0x55, 0xbf, 0xfc, 0xf6, 0xbb, 0x7d, 0x84, 0x83,
-  0xa8, 0xaa, 0x2a, 0x35, 0x5d, 0xd3, 0xcc, 0xeb, 0xe9, 0xdd, 0xf0, 0xf4,
-  0xe4, 0x89, 0x01, 0x6e, 0xdb, 0xe6, 0xec, 0x7c, 0x7c, 0x75, 0x79, 0x31,
-  0x9d, 0xdc, 0xdc, 0x57, 0xbb, 0x89, 0xca, 0x2e, 0xc2, 0x81, 0xcc, 0xa7,
-  0xf5, 0xc3, 0xcf, 0x47, 0xc7, 0xa3, 0xb3, 0xf3, 0x71, 0xfb, 0xff, 0xe3,
-  0xf0, 0x8f, 0x05, 0x5e, 0xcc, 0x70, 0x44, 0x7c, 0xb9, 0xfc, 0xdc, 0xb5,
-  0x5d, 0x44, 0xd4, 0xd3, 0xbb, 0x1f, 0x2e, 0xb0, 0xad, 0xb0, 0x27, 0x45,
-  0xb1, 0xe2, 0x50, 0x9c, 0x17, 0xf9, 0xcf, 0xe3, 0xf1, 0xf2, 0xf4, 0xae,
-  0x3e, 0x42, 0x3f, 0xcc, 0x70, 0x44, 0xcc, 0x66, 0x33, 0x7b, 0x0a, 0x07,
-  0xd4, 0xef, 0xf7, 0x23, 0x62, 0xe5, 0xf4, 0xc6, 0xba, 0x7f, 0x0b, 0xfd,
-  0xfd, 0x0c, 0x03, 0x07, 0xb7, 0xee, 0xe4, 0x5b, 0x6e, 0xfb, 0x00, 0xe0,
-  0xf5, 0xc8, 0x6d, 0x01, 0x18, 0x60, 0xc0, 0x00, 0x03, 0xdb, 0xf8, 0x0f,
-  0xc0, 0xeb, 0xd6, 0x36, 0x57, 0x96, 0x2e, 0x7a, 0x00, 0x00, 0x00, 0x00,
-  0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int bg_odv9_pixel_frame_png_len = 1508;
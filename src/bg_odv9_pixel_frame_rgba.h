@@ -0,0 +1,9607 @@
+// Generated from bg-odv9-pixel-frame.png by tools/png2rgba.c. Do not edit; run 'make assets'.
+#pragma once
+
+const int32_t bg_odv9_pixel_frame_rgba_w = 320;
+const int32_t bg_odv9_pixel_frame_rgba_h = 240;
+uint32_t bg_odv9_pixel_frame_rgba[] = {
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff,
+  0x283e4cff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff,
+  0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x152934ff, 0x283e4cff,
+  0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff,
+  0x152934ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff,
+  0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x0c1f29ff, 0x152934ff,
+  0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x0c1f29ff,
+  0x06141eff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x06141eff,
+  0x0c1f29ff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff,
+  0x0b1925ff, 0x0b1925ff, 0x0b1925ff, 0x162430ff, 0x162430ff, 0x1d2e38ff, 0x162430ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff, 0x1d2e38ff,
+  0x1d2e38ff, 0x162430ff, 0x1d2e38ff, 0x162430ff, 0x162430ff, 0x0b1925ff, 0x0b1925ff, 0x0b1925ff,
+  0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x0c1f29ff, 0x04111cff,
+  0x0b1925ff, 0x0f1d2aff, 0x162430ff, 0x031c29ff, 0x031c29ff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff,
+  0x0f1d2aff, 0x0f1d2aff, 0x0f1d2aff, 0x031c29ff, 0x031c29ff, 0x162430ff, 0x0f1d2aff, 0x0b1925ff,
+  0x04111cff, 0x0c1f29ff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0b1925ff,
+  0x0f1d2aff, 0x162430ff, 0x031c29ff, 0x030e17ff, 0x000b16ff, 0x000a15ff, 0x000a16ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff, 0x000914ff,
+  0x000914ff, 0x000a16ff, 0x000a15ff, 0x000b16ff, 0x030e17ff, 0x031c29ff, 0x162430ff, 0x0f1d2aff,
+  0x0b1925ff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0b1925ff,
+  0x162430ff, 0x031c29ff, 0x030e17ff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x030e17ff, 0x031c29ff, 0x162430ff,
+  0x0b1925ff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x031c29ff, 0x05121cff, 0x05121cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff,
+  0x03131cff, 0x03131cff, 0x03131cff, 0x03131cff, 0x05121cff, 0x05121cff, 0x031c29ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff,
+  0x031725ff, 0x031725ff, 0x031725ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x031625ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x031625ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x031725ff, 0x031625ff, 0x041928ff, 0x041928ff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff, 0x051c2dff,
+  0x041928ff, 0x041928ff, 0x031625ff, 0x031725ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253946ff, 0x243a47ff, 0x243a46ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x041626ff, 0x041626ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x243a46ff, 0x243a47ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041a28ff, 0x041a28ff, 0x041a28ff,
+  0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041a28ff, 0x041928ff,
+  0x041928ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x243a46ff, 0x253b48ff,
+  0x253b48ff, 0x243a46ff, 0x243a46ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff, 0x041928ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x243a46ff, 0x253b48ff,
+  0x223945ff, 0x243a46ff, 0x243a46ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x030e17ff, 0x05121cff, 0x031625ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x05121cff, 0x030e17ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x233947ff, 0x233a46ff, 0x243a46ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0f1d2aff,
+  0x162430ff, 0x031c29ff, 0x05121cff, 0x051520ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x031625ff, 0x031625ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x031625ff, 0x031625ff, 0x031625ff, 0x031625ff,
+  0x041626ff, 0x041626ff, 0x041626ff, 0x041626ff, 0x051520ff, 0x05121cff, 0x031c29ff, 0x162430ff,
+  0x0f1d2aff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x243b46ff, 0x233a46ff, 0x243a46ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0b1925ff,
+  0x162430ff, 0x031c29ff, 0x030e17ff, 0x05121cff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff,
+  0x051520ff, 0x051520ff, 0x051520ff, 0x051520ff, 0x05121cff, 0x030e17ff, 0x031c29ff, 0x162430ff,
+  0x0b1925ff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff, 0x0b1925ff,
+  0x0f1d2aff, 0x10212cff, 0x1b2c37ff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff,
+  0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x05121cff, 0x1b2c37ff, 0x10212cff, 0x0f1d2aff,
+  0x0b1925ff, 0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x0c1f29ff, 0x04111cff,
+  0x0b1925ff, 0x0f1d2aff, 0x10212cff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff,
+  0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x1b2c37ff, 0x10212cff, 0x0f1d2aff, 0x0b1925ff,
+  0x04111cff, 0x0c1f29ff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff, 0x04111cff,
+  0x0b1925ff, 0x0b1925ff, 0x0b1925ff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff,
+  0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x10212cff, 0x0b1925ff, 0x0b1925ff, 0x0b1925ff,
+  0x04111cff, 0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff, 0x152934ff,
+  0x06141eff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff, 0x010e18ff,
+  0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x04111cff, 0x06141eff,
+  0x152934ff, 0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x283e4cff,
+  0x152934ff, 0x152934ff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff,
+  0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x0f232eff, 0x152934ff, 0x152934ff,
+  0x283e4cff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff, 0x283e4cff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff,
+  0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff, 0x253b48ff
+};
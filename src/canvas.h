@@ -0,0 +1,318 @@
+#pragma once
+
+// Where a frame is composed. The software canvas draws on the CPU into a
+// surface and uploads it to a streaming texture; it is the reference every
+// other path is compared against. The locked canvas draws into a surface the
+// same way, then locks the streaming texture and copies the rows in itself,
+// rather than going through SDL_UpdateTexture and the staging copy some
+// drivers make there. The GPU
+// canvas keeps the images and glyph masks in static textures and draws them
+// as textured quads into a render target, so in steady state the CPU touches
+// no pixels.
+//
+// A frame may be composed in full or as a band of rows that changed; the CPU
+// canvases then draw and upload only that band.
+//
+// The frame is presented at the largest whole-number scale that fits the
+// output, centered with black bars around it. With SDL's software renderer,
+// whose scaler is generic and slow, the software canvas scales the frame
+// itself by pixel replication and has SDL copy it out unscaled.
+
+typedef enum { CANVAS_SOFTWARE, CANVAS_LOCKED, CANVAS_GPU } canvas_mode_t;
+
+typedef struct canvas_t canvas_t;
+
+struct canvas_t {
+  canvas_mode_t mode;
+  SDL_Renderer *rend;
+  int32_t w, h;
+  SDL_Rect band;           // the rows being composed
+  // Software and locked
+  SDL_Surface *target;     // what the CPU draws into, while composing
+  SDL_Surface *surface;    // the whole frame, kept between frames
+  SDL_Surface *trans;      // the last frame, faded out over the new one
+  SDL_Texture *upload;     // streaming texture the frame ends up in
+  // GPU
+  SDL_Texture *frame;      // render target the frame is composed in
+  SDL_Texture *trans_tex;  // render target holding the last frame
+  // Presenting
+  SDL_Rect dst;            // where the frame lands in the output
+  int32_t scale;           // dst's size over the frame's
+  bool software_renderer;  // the renderer draws on the CPU
+  SDL_Texture *scaled;     // software: the frame already scaled to dst, or NULL
+};
+
+// Textures made from surfaces and font faces, keyed by their source.
+// There are only a handful, so a linear search is plenty.
+typedef struct { const void *key; SDL_Texture *tex; } canvas_texture_t;
+static canvas_texture_t *canvas_textures = NULL;
+
+static SDL_Texture *canvas_texture_find(const void *key){
+  for(ptrdiff_t i=0; i<arrlen(canvas_textures); i++){
+    if(canvas_textures[i].key == key){ return canvas_textures[i].tex; }
+  }
+  return NULL;
+}
+
+static SDL_Texture *canvas_surface_texture(canvas_t *c, SDL_Surface *s){
+  SDL_Texture *tex = canvas_texture_find(s);
+  if(tex == NULL){
+    tex = SDL_CreateTextureFromSurface(c->rend, s);
+    arrput(canvas_textures, ((canvas_texture_t){ s, tex }));
+  }
+  return tex;
+}
+
+// A face's mask as white on transparent, the foreground pixels in the top
+// half and the background pixels in the bottom half. Color and alpha mods
+// tint each half when a glyph is drawn.
+static SDL_Texture *canvas_face_texture(canvas_t *c, const font_face_t *face){
+  SDL_Texture *tex = canvas_texture_find(face);
+  if(tex == NULL){
+    uint32_t *pixels = malloc(face->w * face->h * 2 * sizeof(uint32_t));
+    for(int32_t i=0; i<face->w*face->h; i++){
+      pixels[i]                   = face->mask[i] == FONT_MASK_FG ? 0xFFFFFFFF : 0;
+      pixels[face->w*face->h + i] = face->mask[i] == FONT_MASK_BG ? 0xFFFFFFFF : 0;
+    }
+    tex = SDL_CreateTexture(c->rend, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, face->w, face->h * 2);
+    SDL_UpdateTexture(tex, NULL, pixels, face->w * sizeof(uint32_t));
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    free(pixels);
+    arrput(canvas_textures, ((canvas_texture_t){ face, tex }));
+  }
+  return tex;
+}
+
+static bool canvas_init_gpu(canvas_t *c){
+  if(!SDL_RenderTargetSupported(c->rend)){ return false; }
+  c->frame = SDL_CreateTexture(c->rend, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, c->w, c->h);
+  c->trans_tex = SDL_CreateTexture(c->rend, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, c->w, c->h);
+  if(c->frame == NULL || c->trans_tex == NULL){
+    SDL_DestroyTexture(c->frame);
+    SDL_DestroyTexture(c->trans_tex);
+    c->frame = c->trans_tex = NULL;
+    return false;
+  }
+  SDL_SetTextureBlendMode(c->frame, SDL_BLENDMODE_NONE);
+  SDL_SetTextureBlendMode(c->trans_tex, SDL_BLENDMODE_BLEND);
+  return true;
+}
+
+// Copies h rows of the software canvas's surface from y on into the scaled
+// texture, each pixel made a scale by scale block.
+static bool canvas_scale_rows(canvas_t *c, int32_t y, int32_t h){
+  SDL_Rect r = { 0, y * c->scale, c->dst.w, h * c->scale };
+  void *pixels; int pitch;
+  if(SDL_LockTexture(c->scaled, &r, &pixels, &pitch) != 0){ return false; }
+  for(int32_t i=0; i<h; i++){
+    uint8_t *row = (uint8_t *)pixels + i * c->scale * pitch;
+    pixel_scale((uint32_t *)row, surface_row(c->surface, y + i), c->w, c->scale);
+    for(int32_t k=1; k<c->scale; k++){ memcpy(row + k * pitch, row, c->dst.w * sizeof(uint32_t)); }
+  }
+  SDL_UnlockTexture(c->scaled);
+  return true;
+}
+
+// Gives up scaling on the CPU, which leaves it to the renderer.
+static void canvas_drop_scaled(canvas_t *c){
+  printf("WARNING: Cannot scale the screen in software (%s), leaving it to the renderer.\n", SDL_GetError());
+  SDL_DestroyTexture(c->scaled);
+  c->scaled = NULL;
+  SDL_UpdateTexture(c->upload, NULL, c->surface->pixels, c->surface->pitch);
+}
+
+// Works out dst for the renderer's current output size. Called by
+// canvas_init and again whenever the output is resized.
+void canvas_layout(canvas_t *c){
+  int ow, oh;
+  if(SDL_GetRendererOutputSize(c->rend, &ow, &oh) != 0){ ow = c->w; oh = c->h; }
+  int32_t scale = ow / c->w < oh / c->h ? ow / c->w : oh / c->h;
+  if(scale < 1){ scale = 1; }
+  c->dst = (SDL_Rect){ (ow - c->w * scale) / 2, (oh - c->h * scale) / 2, c->w * scale, c->h * scale };
+  if(scale == c->scale){ return; }
+  c->scale = scale;
+
+  if(c->scaled != NULL){
+    SDL_DestroyTexture(c->scaled);
+    c->scaled = NULL;
+    // upload was not kept up to date while the CPU scaled the frame.
+    SDL_UpdateTexture(c->upload, NULL, c->surface->pixels, c->surface->pitch);
+  }
+  if(c->mode != CANVAS_SOFTWARE || !c->software_renderer || scale == 1){ return; }
+  c->scaled = SDL_CreateTexture(c->rend, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STREAMING, c->dst.w, c->dst.h);
+  if(c->scaled == NULL || !canvas_scale_rows(c, 0, c->h)){ canvas_drop_scaled(c); }
+}
+
+// Falls back to the software canvas if the renderer cannot draw into textures.
+void canvas_init(canvas_t *c, SDL_Renderer *rend, int32_t w, int32_t h, canvas_mode_t mode){
+  memset(c, 0, sizeof(canvas_t));
+  c->rend = rend;
+  c->w = w;
+  c->h = h;
+  c->mode = mode;
+  if(c->mode == CANVAS_GPU && !canvas_init_gpu(c)){
+    printf("WARNING: Renderer lacks render targets, composing in software.\n");
+    c->mode = CANVAS_SOFTWARE;
+  }
+  if(c->mode != CANVAS_GPU){
+    c->surface = create_surface(w, h);
+    c->trans = create_surface(w, h);
+    c->upload = SDL_CreateTexture(rend, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STREAMING, w, h);
+  }
+  SDL_RendererInfo info;
+  c->software_renderer = SDL_GetRendererInfo(rend, &info) == 0 && (info.flags & SDL_RENDERER_SOFTWARE);
+  canvas_layout(c);
+}
+
+// Starts a frame, drawn only in the h rows from y down; the rows outside keep
+// the last frame.
+void canvas_begin(canvas_t *c, int32_t y, int32_t h){
+  c->band = (SDL_Rect){ 0, y, c->w, h };
+  if(c->mode == CANVAS_GPU){
+    SDL_SetRenderTarget(c->rend, c->frame);
+  }else{
+    c->target = c->surface;
+    SDL_SetClipRect(c->surface, &c->band);
+  }
+}
+
+// Copies the band into the streaming texture through a lock. Returns false
+// if the texture cannot be locked.
+static bool canvas_upload_locked(canvas_t *c){
+  void *pixels; int pitch;
+  if(SDL_LockTexture(c->upload, &c->band, &pixels, &pitch) != 0){ return false; }
+  for(int32_t i=0; i<c->band.h; i++){
+    pixel_copy((uint32_t *)((uint8_t *)pixels + i * pitch), surface_row(c->surface, c->band.y + i), c->w);
+  }
+  SDL_UnlockTexture(c->upload);
+  return true;
+}
+
+void canvas_end(canvas_t *c){
+  if(c->mode == CANVAS_GPU){
+    SDL_SetRenderTarget(c->rend, NULL);
+    return;
+  }
+  SDL_SetClipRect(c->surface, NULL);
+  c->target = NULL;
+  if(c->mode == CANVAS_LOCKED && !canvas_upload_locked(c)){
+    printf("WARNING: Cannot lock the screen texture (%s), uploading in software.\n", SDL_GetError());
+    c->mode = CANVAS_SOFTWARE;
+  }
+  if(c->mode == CANVAS_LOCKED){ return; }
+  if(c->scaled == NULL){
+    SDL_UpdateTexture(c->upload, &c->band, surface_row(c->surface, c->band.y), c->surface->pitch);
+  }else if(!canvas_scale_rows(c, c->band.y, c->band.h)){
+    canvas_drop_scaled(c);
+  }
+}
+
+static void canvas_image(canvas_t *c, SDL_Surface *img, int32_t x, int32_t y, SDL_BlendMode mode){
+  SDL_Texture *tex = canvas_surface_texture(c, img);
+  SDL_Rect dst = { x, y, img->w, img->h };
+  SDL_SetTextureBlendMode(tex, mode);
+  SDL_RenderCopy(c->rend, tex, NULL, &dst);
+}
+
+// Draws an opaque image, replacing what is under it.
+void canvas_copy(canvas_t *c, SDL_Surface *img, int32_t x, int32_t y){
+  if(c->mode == CANVAS_GPU){ canvas_image(c, img, x, y, SDL_BLENDMODE_NONE); }
+  else{ surface_copy(img, c->target, x, y); }
+}
+
+void canvas_blend(canvas_t *c, SDL_Surface *img, int32_t x, int32_t y){
+  if(c->mode == CANVAS_GPU){ canvas_image(c, img, x, y, SDL_BLENDMODE_BLEND); }
+  else{ surface_blend(img, c->target, x, y); }
+}
+
+// Tints one half of a face texture. The color is laid over transparent black
+// first, as font_draw_glyph does, so both paths darken translucent colors alike.
+static void canvas_tint(SDL_Texture *tex, uint32_t color){
+  uint32_t p = pixel_over(color, 0);
+  SDL_SetTextureColorMod(tex, p >> 24, (p >> 16) & 0xFF, (p >> 8) & 0xFF);
+  SDL_SetTextureAlphaMod(tex, p & 0xFF);
+}
+
+// Each glyph gets its background and then its foreground before the next
+// glyph is drawn, so overlapping neighbors layer as in the software path.
+static void canvas_glyphs_gpu(canvas_t *c, font_t *font, const char *string, uint32_t len, int32_t x, int32_t y){
+  const font_face_t *face = font->face;
+  SDL_Texture *tex = canvas_face_texture(c, face);
+  int32_t pen = x;
+  for(uint32_t i=0; i<len && string[i]!='\0'; i++){
+    const glyph_t *g = &face->glyphs[(uint8_t)string[i]];
+    if(g->w > 0){
+      SDL_Rect dst = { pen - g->head, y, g->w, face->h };
+      SDL_Rect bg = { g->x, face->h, g->w, face->h };
+      SDL_Rect fg = { g->x, 0, g->w, face->h };
+      canvas_tint(tex, font->bg); SDL_RenderCopy(c->rend, tex, &bg, &dst);
+      canvas_tint(tex, font->fg); SDL_RenderCopy(c->rend, tex, &fg, &dst);
+      pen += glyph_advance(g);
+    }
+  }
+}
+
+void canvas_string(canvas_t *c, font_t *font, const char *string, int32_t x, int32_t y){
+  if(string == NULL){ return; }
+  if(c->mode == CANVAS_GPU){ canvas_glyphs_gpu(c, font, string, UINT32_MAX, x, y); }
+  else{ font_draw_string(font, string, x, y, c->target); }
+}
+
+// Draws the first len characters of string wrapped to w pixels.
+uint32_t canvas_wrap_partial_string(canvas_t *c, font_t *font, const char *string, uint32_t len, int32_t x, int32_t y, uint32_t w){
+  if(string == NULL){ return 0; }
+  if(c->mode != CANVAS_GPU){ return font_wrap_partial_string(font, string, len, x, y, w, c->target); }
+  const text_layout_t *layout = font_layout(font, string, w);
+  uint32_t total_height = 0;
+  for(ptrdiff_t i=0; i<arrlen(layout->lines); i++){
+    const text_line_t *line = &layout->lines[i];
+    if(line->start > len){ break; }
+    uint32_t n = (len - line->start < line->len) ? len - line->start : line->len;
+    canvas_glyphs_gpu(c, font, &layout->string[line->start], n, x, y + total_height);
+    total_height += layout->face->h;
+  }
+  return total_height;
+}
+
+uint32_t canvas_wrap_string(canvas_t *c, font_t *font, const char *string, int32_t x, int32_t y, uint32_t w){
+  return canvas_wrap_partial_string(c, font, string, UINT32_MAX, x, y, w);
+}
+
+// Keeps the frame last composed, to fade out over the ones that follow.
+void canvas_snapshot(canvas_t *c){
+  if(c->mode == CANVAS_GPU){
+    SDL_SetRenderTarget(c->rend, c->trans_tex);
+    SDL_RenderCopy(c->rend, c->frame, NULL, NULL);
+    SDL_SetRenderTarget(c->rend, NULL);
+  }else{
+    surface_copy(c->surface, c->trans, 0, 0);
+  }
+}
+
+// Copies the frame last composed into dst, a surface the frame's size.
+void canvas_read(canvas_t *c, SDL_Surface *dst){
+  if(c->mode == CANVAS_GPU){
+    SDL_SetRenderTarget(c->rend, c->frame);
+    SDL_RenderReadPixels(c->rend, NULL, SDL_PIXELFORMAT_RGBA8888, dst->pixels, dst->pitch);
+    SDL_SetRenderTarget(c->rend, NULL);
+  }else{
+    surface_copy(c->surface, dst, 0, 0);
+  }
+}
+
+// Lays the snapshot over the frame at a fixed alpha.
+void canvas_fade(canvas_t *c, uint8_t alpha){
+  if(c->mode == CANVAS_GPU){
+    SDL_SetTextureAlphaMod(c->trans_tex, alpha);
+    SDL_RenderCopy(c->rend, c->trans_tex, NULL, NULL);
+  }else{
+    surface_fade(c->trans, c->target, 0, 0, alpha);
+  }
+}
+
+void canvas_present(canvas_t *c){
+  SDL_Texture *tex = c->scaled != NULL ? c->scaled : c->mode == CANVAS_GPU ? c->frame : c->upload;
+  SDL_RenderClear(c->rend);
+  SDL_RenderCopy(c->rend, tex, NULL, &c->dst);
+  SDL_RenderPresent(c->rend);
+}
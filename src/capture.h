@@ -0,0 +1,157 @@
+#pragma once
+
+// Records gameplay at the native resolution. Each frame presented is copied
+// into a ring of CAPTURE_FRAMES frames allocated up front, and a worker
+// thread encodes them, either to one animated PNG or to a numbered sequence
+// of PNGs. The main thread never waits on the worker: when the ring is full
+// the frame is dropped and counted, and the frame on screen is copied as
+// soon as there is room again, even if it has not changed, so the capture
+// catches up.
+//
+// Frames are only presented when the screen changes, so each carries the
+// tick it appeared at. In an animated PNG that sets how long the frame
+// before it is shown; a sequence has the tick in each file's name.
+
+#define CAPTURE_FRAMES 32
+
+typedef struct {
+  SDL_Surface *image;
+  uint32_t tick;
+} capture_frame_t;
+
+static struct {
+  SDL_Thread *thread;
+  SDL_mutex *lock;
+  SDL_cond *wake;
+  capture_frame_t ring[CAPTURE_FRAMES];
+  uint32_t head;     // frames handed to the worker
+  uint32_t tail;     // frames it has encoded; the ring holds head - tail
+  uint32_t end_tick; // tick the capture stopped at, once it has
+  uint16_t tick_rate; // ticks per second
+  bool quit;
+  bool behind;       // a frame was dropped and nothing has been copied since
+  uint32_t dropped;
+  const char *fn;    // the APNG, or the sequence's file name pattern
+  bool sequence;
+  apng_t apng;
+} CAPTURE;
+
+static bool capture_on(void){ return CAPTURE.thread != NULL; }
+
+static void capture_encode(const capture_frame_t *f, uint32_t until){
+  if(CAPTURE.sequence){
+    char fn[1024];
+    snprintf(fn, sizeof(fn), CAPTURE.fn, f->tick);
+    png_write(fn, f->image);
+  }else{
+    uint32_t ticks = until - f->tick;
+    apng_frame(&CAPTURE.apng, f->image, ticks > 0xFFFF ? 0xFFFF : ticks, CAPTURE.tick_rate);
+  }
+}
+
+// An animated PNG frame is held until the one after it arrives, as only then
+// is it known how long it stays on screen.
+static int capture_main(void *data){
+  (void)(data); // Suppress unused warning
+  SDL_LockMutex(CAPTURE.lock);
+  while(true){
+    uint32_t held = CAPTURE.sequence || CAPTURE.quit ? 0 : 1;
+    while(CAPTURE.head - CAPTURE.tail <= held && !CAPTURE.quit){
+      SDL_CondWait(CAPTURE.wake, CAPTURE.lock);
+      held = CAPTURE.sequence || CAPTURE.quit ? 0 : 1;
+    }
+    if(CAPTURE.head == CAPTURE.tail){ break; } // Quitting, and all encoded
+    const capture_frame_t *f = &CAPTURE.ring[CAPTURE.tail % CAPTURE_FRAMES];
+    uint32_t until = CAPTURE.head - CAPTURE.tail > 1 ? CAPTURE.ring[(CAPTURE.tail + 1) % CAPTURE_FRAMES].tick : CAPTURE.end_tick;
+    SDL_UnlockMutex(CAPTURE.lock);
+
+    capture_encode(f, until);
+
+    SDL_LockMutex(CAPTURE.lock);
+    CAPTURE.tail += 1;
+  }
+  SDL_UnlockMutex(CAPTURE.lock);
+  return 0;
+}
+
+// Whether a sequence's file name pattern takes the tick as its one and only
+// conversion: a %u, %x, %X or %o with optional flags and width. %% is allowed.
+static bool capture_pattern_ok(const char *fn){
+  int conversions = 0;
+  for(const char *p=fn; *p!='\0'; p++){
+    if(*p != '%'){ continue; }
+    p++;
+    if(*p == '%'){ continue; }
+    while(*p == '0' || *p == '-' || *p == '#'){ p++; }
+    while(*p >= '0' && *p <= '9'){ p++; }
+    if(*p != 'u' && *p != 'x' && *p != 'X' && *p != 'o'){ return false; }
+    conversions += 1;
+  }
+  return conversions == 1;
+}
+
+// Starts capturing w by h frames to fn, timed in ticks of 1/tick_rate s. A
+// name with a % in it, such as "shot-%08u.png", is taken as a pattern for a
+// PNG sequence; anything else is written as one animated PNG.
+bool capture_start(const char *fn, int32_t w, int32_t h, uint16_t tick_rate){
+  CAPTURE.fn = fn;
+  CAPTURE.tick_rate = tick_rate;
+  CAPTURE.sequence = strchr(fn, '%') != NULL;
+  if(CAPTURE.sequence && !capture_pattern_ok(fn)){
+    fprintf(stderr, "ERROR: capture_start: %s should have one %%u for the tick, like shot-%%08u.png\n", fn);
+    return false;
+  }
+  if(!CAPTURE.sequence && !apng_begin(&CAPTURE.apng, fn, w, h)){ return false; }
+  for(int i=0; i<CAPTURE_FRAMES; i++){ CAPTURE.ring[i].image = create_surface(w, h); }
+  CAPTURE.lock = SDL_CreateMutex();
+  CAPTURE.wake = SDL_CreateCond();
+  CAPTURE.thread = SDL_CreateThread(capture_main, "capture", NULL);
+  if(CAPTURE.thread == NULL){
+    fprintf(stderr, "ERROR: capture_start: %s\n", SDL_GetError());
+    return false;
+  }
+  return true;
+}
+
+// Whether the frame on screen should be copied even though it is not new.
+bool capture_behind(void){
+  return capture_on() && CAPTURE.behind;
+}
+
+// Copies the frame last composed on c into the ring. fresh is whether it was
+// composed at this tick or is an old one being copied to catch up.
+void capture_frame(canvas_t *c, uint32_t tick, bool fresh){
+  if(!capture_on()){ return; }
+  SDL_LockMutex(CAPTURE.lock);
+  bool full = CAPTURE.head - CAPTURE.tail == CAPTURE_FRAMES;
+  SDL_UnlockMutex(CAPTURE.lock);
+  if(full){
+    if(fresh){ CAPTURE.dropped += 1; }
+    CAPTURE.behind = true;
+    return;
+  }
+  // The slot at head is the main thread's until head moves past it.
+  capture_frame_t *f = &CAPTURE.ring[CAPTURE.head % CAPTURE_FRAMES];
+  canvas_read(c, f->image);
+  f->tick = tick;
+  CAPTURE.behind = false;
+
+  SDL_LockMutex(CAPTURE.lock);
+  CAPTURE.head += 1;
+  SDL_CondSignal(CAPTURE.wake);
+  SDL_UnlockMutex(CAPTURE.lock);
+}
+
+// Waits for every frame in the ring to be encoded, then closes the capture.
+void capture_finish(uint32_t tick){
+  if(!capture_on()){ return; }
+  SDL_LockMutex(CAPTURE.lock);
+  CAPTURE.end_tick = tick;
+  CAPTURE.quit = true;
+  SDL_CondSignal(CAPTURE.wake);
+  SDL_UnlockMutex(CAPTURE.lock);
+  SDL_WaitThread(CAPTURE.thread, NULL);
+  CAPTURE.thread = NULL;
+  if(!CAPTURE.sequence){ apng_end(&CAPTURE.apng); }
+  printf("Capture: %u frames to %s, %u dropped\n", CAPTURE.head, CAPTURE.fn, CAPTURE.dropped);
+}
@@ -1,22 +0,0 @@
-unsigned char cursor_arrow_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xbe, 0x8b, 0x00, 0x00, 0x00,
-  0x01, 0x73, 0x52, 0x47, 0x42, 0x01, 0xd9, 0xc9, 0x2c, 0x7f, 0x00, 0x00,
-  0x00, 0x04, 0x67, 0x41, 0x4d, 0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc,
-  0x61, 0x05, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00,
-  0x7a, 0x26, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
-  0x80, 0xe8, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0xea, 0x60, 0x00, 0x00,
-  0x3a, 0x98, 0x00, 0x00, 0x17, 0x70, 0x9c, 0xba, 0x51, 0x3c, 0x00, 0x00,
-  0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00, 0x00,
-  0x2e, 0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x07, 0x74,
-  0x49, 0x4d, 0x45, 0x07, 0xe9, 0x07, 0x06, 0x0f, 0x16, 0x08, 0x73, 0xcb,
-  0x19, 0xfe, 0x00, 0x00, 0x00, 0x33, 0x49, 0x44, 0x41, 0x54, 0x18, 0xd3,
-  0x63, 0x60, 0x40, 0x02, 0x4a, 0x2e, 0xa1, 0xff, 0x95, 0x5c, 0x42, 0xff,
-  0x33, 0x60, 0x03, 0x4a, 0x2e, 0xa1, 0xff, 0x7d, 0xb6, 0x9f, 0xfd, 0x1f,
-  0xfa, 0xee, 0x3f, 0x4e, 0x45, 0xff, 0xc9, 0x52, 0xc4, 0xc4, 0x40, 0x02,
-  0xc0, 0x6f, 0x05, 0x31, 0xf6, 0x63, 0xf5, 0x26, 0x00, 0xa3, 0x28, 0x39,
-  0x7c, 0x8a, 0xfb, 0xdc, 0x48, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e,
-  0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int cursor_arrow_png_len = 221;
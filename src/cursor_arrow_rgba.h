@@ -0,0 +1,15 @@
+// Generated from cursor-arrow.png by tools/png2rgba.c. Do not edit; run 'make assets'.
+#pragma once
+
+const int32_t cursor_arrow_rgba_w = 8;
+const int32_t cursor_arrow_rgba_h = 8;
+uint32_t cursor_arrow_rgba[] = {
+  0x00000000, 0x00000000, 0x00000000, 0x224455ff, 0x224455ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x224455ff, 0x4cb7cdff, 0x55eeffff, 0x224455ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x000000ff, 0x224455ff, 0x4cb7cdff, 0x55eeffff, 0x224455ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x224455ff, 0x4cb7cdff, 0x55eeffff, 0x224455ff,
+  0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x224455ff, 0x4cb7cdff, 0x55eeffff, 0x224455ff,
+  0x00000000, 0x00000000, 0x000000ff, 0x224455ff, 0x4cb7cdff, 0x55eeffff, 0x224455ff, 0x00000000,
+  0x00000000, 0x00000000, 0x224455ff, 0x4cb7cdff, 0x55eeffff, 0x224455ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x224455ff, 0x224455ff, 0x00000000, 0x00000000, 0x00000000
+};
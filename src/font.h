@@ -1,29 +1,48 @@
 #pragma once
 
 #define GLYPH_ARRAY_SIZE 256
-#define STRING_BUFFER_SIZE 2048
 
 const char *glyph_order = " 1234567890-=`!@#$%^&*()_+~abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ[]\\;',./{}|:\"<>?";
 
 typedef struct {
-  SDL_Surface *glyphs[GLYPH_ARRAY_SIZE];
-  uint32_t head_kerns[GLYPH_ARRAY_SIZE];
-  uint32_t tail_kerns[GLYPH_ARRAY_SIZE];
+  int16_t x;    // column of the glyph in the mask
+  int16_t w;    // width of the glyph in pixels, zero if the font lacks it
+  int16_t head; // columns the glyph overhangs the previous one
+  int16_t tail; // columns the next glyph may overhang this one
+} glyph_t;
+
+// What each pixel of a face's mask is painted with when drawn.
+#define FONT_MASK_NONE 0
+#define FONT_MASK_BG   1
+#define FONT_MASK_FG   2
+
+// One font image, loaded once however many colors it is drawn in.
+typedef struct {
+  uint8_t *mask;  // every glyph packed side by side, one byte per pixel
+  int32_t w, h;   // size of the mask
+  glyph_t glyphs[GLYPH_ARRAY_SIZE];
+} font_face_t;
+
+// A face plus the colors to draw it in. Cheap: the face is shared.
+typedef struct {
+  font_face_t *face;
+  uint32_t fg;
+  uint32_t bg;
 } font_t;
 
-font_t *font_create(const char *image_fn, uint32_t fg_color, uint32_t bg_color){
-  font_t *font = malloc(sizeof(font_t));
-  memset(font, 0, sizeof(font_t));
+static struct { char *key; font_face_t *value; } *face_cache = NULL;
 
-  SDL_Surface *load_img = get_image(image_fn);
-  SDL_Surface *font_img = create_surface(load_img->w,load_img->h);
-  SDL_BlitSurface(load_img,NULL,font_img,NULL);
-  uint32_t *pixels = font_img->pixels;
+static inline int32_t glyph_advance(const glyph_t *g){ return g->w - g->head - g->tail + 1; }
 
-  for(int i=0; i<(font_img->w*font_img->h); i+=1) { 
-    if(pixels[i] == 0xFFFFFFFF){ pixels[i] = fg_color; } 
-    if(pixels[i] == 0x000000FF){ pixels[i] = bg_color; } 
-  }
+// Splits a font image into glyphs. The top row marks where each glyph
+// starts and how far it kerns; the rows below are white where the glyph is
+// drawn in the foreground color and black where it gets the background.
+font_face_t *font_face_load(const char *image_fn){
+  SDL_Surface *font_img = get_image(image_fn);
+  const uint32_t *pixels = font_img->pixels;
+
+  font_face_t *face = malloc(sizeof(font_face_t));
+  memset(face, 0, sizeof(font_face_t));
 
   int32_t this_mark = 0;
   int32_t prev_mark = 0;
@@ -31,8 +50,6 @@ font_t *font_create(const char *image_fn, uint32_t fg_color, uint32_t bg_color){
   uint32_t mark_color = pixels[0];
 
   uint32_t glyph_index = 0;
-  SDL_Rect glyph_rect;
-  SDL_Surface *glyph_surface;
 
   uint32_t glyph_count = strlen(glyph_order);
 
@@ -56,7 +73,7 @@ font_t *font_create(const char *image_fn, uint32_t fg_color, uint32_t bg_color){
       kern_mark += 1;
       kern_counter += 1;
     }
-    font->head_kerns[ascii_code] = kern_counter;
+    face->glyphs[ascii_code].head = kern_counter;
 
     // Measure Glyph
     prev_mark = this_mark;
@@ -72,7 +89,7 @@ font_t *font_create(const char *image_fn, uint32_t fg_color, uint32_t bg_color){
       kern_mark -= 1;
       kern_counter += 1;
     }
-    font->tail_kerns[ascii_code] = kern_counter;
+    face->glyphs[ascii_code].tail = kern_counter;
 
     // Check if we have run out of glyphs early.
     if(this_mark > font_img->w){
@@ -80,154 +97,259 @@ font_t *font_create(const char *image_fn, uint32_t fg_color, uint32_t bg_color){
       break;
     }
 
-    // Record glyph to its own surface
-    glyph_rect.x = prev_mark;
-    glyph_rect.w = this_mark - prev_mark;
-    glyph_rect.y = 1;
-    glyph_rect.h = font_img->h-1;
+    // Record glyph position within the mask
+    face->glyphs[ascii_code].x = prev_mark;
+    face->glyphs[ascii_code].w = this_mark - prev_mark;
 
-    glyph_surface = create_surface(glyph_rect.w, glyph_rect.h);
-    SDL_BlitSurface(font_img, &glyph_rect, glyph_surface, NULL);
+    glyph_index += 1;
+  }
 
-    font->glyphs[(int)glyph_order[glyph_index]] = glyph_surface;
+  // The mask is the font image minus the marker row on top.
+  face->w = font_img->w;
+  face->h = font_img->h - 1;
+  face->mask = malloc(face->w * face->h);
+  for(int32_t y=0; y<face->h; y++){
+    const uint32_t *row = (const uint32_t *)((const uint8_t *)font_img->pixels + (y+1)*font_img->pitch);
+    for(int32_t x=0; x<face->w; x++){
+      uint8_t m = FONT_MASK_NONE;
+      if(row[x] == 0xFFFFFFFF){ m = FONT_MASK_FG; }
+      if(row[x] == 0x000000FF){ m = FONT_MASK_BG; }
+      face->mask[y*face->w + x] = m;
+    }
+  }
 
-    glyph_index += 1;
+  return face;
+}
+
+font_face_t *font_face_get(const char *image_fn){
+  font_face_t *face = shget(face_cache, image_fn);
+  if(face == NULL){
+    face = font_face_load(image_fn);
+    shput(face_cache, image_fn, face);
   }
+  return face;
+}
 
+// Only the first font_create for an image loads it; the rest share the face.
+font_t *font_create(const char *image_fn, uint32_t fg_color, uint32_t bg_color){
+  font_t *font = malloc(sizeof(font_t));
+  font->face = font_face_get(image_fn);
+  font->fg = fg_color;
+  font->bg = bg_color;
   return font;
 }
 
 void font_delete(font_t *font){
-  for(int32_t i=0; i<GLYPH_ARRAY_SIZE; i++){
-    if(font->glyphs[i] != NULL){
-      SDL_FreeSurface(font->glyphs[i]);
-    }
-  }
-
   free(font);
 }
 
-void font_draw_string(font_t *font, const char *string, uint32_t x, uint32_t y, SDL_Surface *target){
-  if(string == NULL){ return; }
-  SDL_Rect target_rect;
-  target_rect.x = x;
-  target_rect.y = y;
-  for(uint32_t i=0; i<strlen(string); i++){
-    uint8_t ascii_code = (int)string[i];
-
-    if(font->glyphs[ascii_code] != NULL){
-      target_rect.x -= font->head_kerns[ascii_code];
-      SDL_BlitSurface(font->glyphs[ascii_code], NULL, target, &target_rect);
-      target_rect.x += font->glyphs[ascii_code]->w;
-      target_rect.x -= font->tail_kerns[ascii_code];
-      target_rect.x += 1;
+// Paints one glyph out of the mask in the font's colors, row by row,
+// clipped to the target.
+void font_draw_glyph(font_t *font, uint8_t ascii_code, int32_t x, int32_t y, SDL_Surface *target){
+  const font_face_t *face = font->face;
+  const glyph_t *g = &face->glyphs[ascii_code];
+  const SDL_Rect *clip = &target->clip_rect;
+  // Translucent colors have always been laid over transparent black first,
+  // which darkens them; the fonts are tuned to look right that way.
+  const uint32_t palette[3] = { 0, pixel_over(font->bg, 0), pixel_over(font->fg, 0) };
+
+  int32_t x0 = x > clip->x ? x : clip->x;
+  int32_t y0 = y > clip->y ? y : clip->y;
+  int32_t x1 = x + g->w < clip->x + clip->w ? x + g->w : clip->x + clip->w;
+  int32_t y1 = y + face->h < clip->y + clip->h ? y + face->h : clip->y + clip->h;
+  if(x0 >= x1 || y0 >= y1){ return; }
+
+  for(int32_t ty=y0; ty<y1; ty++){
+    const uint8_t *src = face->mask + (ty-y)*face->w + g->x + (x0-x);
+    uint32_t *dst = (uint32_t *)((uint8_t *)target->pixels + ty*target->pitch) + x0;
+    for(int32_t i=0; i<x1-x0; i++){
+      if(src[i] != FONT_MASK_NONE){ dst[i] = pixel_over(palette[src[i]], dst[i]); }
     }
   }
 }
 
-
-void font_draw_partial_string(font_t *font, const char *string, uint32_t len, uint32_t x, uint32_t y, SDL_Surface *target){
+void font_draw_partial_string(font_t *font, const char *string, uint32_t len, int32_t x, int32_t y, SDL_Surface *target){
   if(string == NULL){ return; }
-  char temp[STRING_BUFFER_SIZE];
-
-  if(len >= strlen(string)){
-    font_draw_string(font, string, x, y, target);
-  }else{
-    strncpy(temp, string, len);
-    temp[len] = '\0';
-    font_draw_string(font, temp, x, y, target);
+  int32_t pen = x;
+  for(uint32_t i=0; i<len && string[i]!='\0'; i++){
+    uint8_t ascii_code = (uint8_t)string[i];
+    const glyph_t *g = &font->face->glyphs[ascii_code];
+
+    if(g->w > 0){
+      font_draw_glyph(font, ascii_code, pen - g->head, y, target);
+      pen += glyph_advance(g);
+    }
   }
 }
 
+void font_draw_string(font_t *font, const char *string, int32_t x, int32_t y, SDL_Surface *target){
+  font_draw_partial_string(font, string, UINT32_MAX, x, y, target);
+}
+
 uint32_t font_get_width(font_t *font, const char *string){
   if(string == NULL){ return 0; }
   int32_t w = 0;
-  for(uint32_t i=0; i<strlen(string); i++){
-    uint8_t ascii_code = (int)string[i];
-    if(font->glyphs[ascii_code] != NULL){
-      w -= font->head_kerns[ascii_code];
-      w += font->glyphs[ascii_code]->w;
-      w -= font->tail_kerns[ascii_code];
-      w += 1;
-    }
+  for(const char *c=string; *c!='\0'; c++){
+    const glyph_t *g = &font->face->glyphs[(uint8_t)*c];
+    if(g->w > 0){ w += glyph_advance(g); }
   }
   return w;
 }
 
 uint32_t font_get_height(font_t *font){
-  return font->glyphs[(int)glyph_order[0]]->h;
+  return font->face->h;
 }
 
-uint32_t font_wrap_string(font_t *font, const char *string, uint32_t x, uint32_t y, uint32_t w, SDL_Surface *target){
-  if(string == NULL){ return 0; }
-  char temp[STRING_BUFFER_SIZE];
-  uint32_t h = font_get_height(font);
-  uint32_t line_start = 0;
-  uint32_t line_end = 0;
-  bool wrap_now = false;
+////////////////////////// TEXT LAYOUT //////////////////////////
 
-  uint32_t total_height = 0;
+#define LAYOUT_CACHE_SIZE 256
+
+typedef struct {
+  uint32_t start; // offset of the line's first character in the string
+  uint32_t len;   // number of characters on the line
+} text_line_t;
+
+// Line breaks depend only on the face, so all colors of a face share them.
+typedef struct {
+  font_face_t *face;
+  uint32_t w;         // width the text was wrapped to
+  char *string;       // private copy of the text the layout was built from
+  text_line_t *lines; // stb_ds array of line breaks
+} text_layout_t;
+
+// Direct-mapped: a layout whose key lands on an occupied slot evicts it.
+static text_layout_t *layout_cache[LAYOUT_CACHE_SIZE];
+
+static uint64_t layout_key(font_face_t *face, const char *string, uint32_t w){
+  uint64_t h = 14695981039346656037ULL;
+  for(const char *c=string; *c!='\0'; c++){ h = (h ^ (uint8_t)*c) * 1099511628211ULL; }
+  h = (h ^ (uintptr_t)face) * 1099511628211ULL;
+  return (h ^ w) * 1099511628211ULL;
+}
 
-  while(line_end <= strlen(string)){
-    wrap_now = false;
-    strncpy(temp, &(string[line_start]), line_end-line_start);
-    temp[line_end-line_start] = '\0';
-
-    if(string[line_end] == '\n'){
-      wrap_now = true;
-    }else if(font_get_width(font, temp) > w){
-      int32_t temp_end = line_end;
-      while(string[line_end] != ' '){
-        line_end -= 1;
-        if(line_end == 0){
-          line_end = temp_end;
-          break;
-        }
-      }
-      wrap_now = true;
-    }else if(line_end == strlen(string)){
-      wrap_now = true;
+static void layout_free(text_layout_t *layout){
+  if(layout == NULL){ return; }
+  arrfree(layout->lines);
+  free(layout->string);
+  free(layout);
+}
+
+// Greedy word wrap in a single pass over the string. Each character's
+// advance is added to a running width; when it overflows, the line breaks at
+// the last space and only the partial word after it is measured again.
+static void layout_build(text_layout_t *layout){
+  const char *s = layout->string;
+  uint32_t start = 0;
+  int32_t pen = 0;
+  int32_t space = -1;
+
+  for(int32_t i=0; ; i++){
+    if(s[i] == '\0' || s[i] == '\n'){
+      arrput(layout->lines, ((text_line_t){ start, i - start }));
+      if(s[i] == '\0'){ break; }
+      start = i + 1; pen = 0; space = -1;
+      continue;
     }
 
-    if(wrap_now){
-      font_draw_partial_string(font, &(string[line_start]), line_end-line_start, x, y, target);
-      line_start = line_end;
-      if(string[line_start] == ' '){ line_start += 1; }
-      line_end = line_start + 1;
-      y += h;
-      total_height += h;
-    }else{
-      line_end += 1;
+    const glyph_t *g = &layout->face->glyphs[(uint8_t)s[i]];
+    if(g->w > 0){ pen += glyph_advance(g); }
+    if(s[i] == ' '){ space = i; }
+
+    if(pen > (int32_t)layout->w && i > (int32_t)start){
+      // A word ending right at the overflow keeps its line, as it always has.
+      int32_t brk = (s[i+1] == ' ') ? i + 1 : (space > (int32_t)start ? space : i);
+      arrput(layout->lines, ((text_line_t){ start, brk - start }));
+      start = (s[brk] == ' ') ? brk + 1 : brk;
+      if(s[start] == '\0'){ break; }
+      pen = 0; space = -1;
+      i = start - 1;
     }
   }
+}
+
+// Returns the line breaks for string wrapped to w pixels, building them only
+// the first time this face, text and width are seen.
+const text_layout_t *font_layout(font_t *font, const char *string, uint32_t w){
+  text_layout_t **slot = &layout_cache[layout_key(font->face, string, w) % LAYOUT_CACHE_SIZE];
+  text_layout_t *layout = *slot;
+  if(layout != NULL && layout->face == font->face && layout->w == w && strcmp(layout->string, string) == 0){
+    return layout;
+  }
+  layout_free(layout);
+
+  layout = malloc(sizeof(text_layout_t));
+  memset(layout, 0, sizeof(text_layout_t));
+  layout->face = font->face;
+  layout->w = w;
+  layout->string = malloc(strlen(string) + 1);
+  strcpy(layout->string, string);
+  layout_build(layout);
+
+  *slot = layout;
+  return layout;
+}
+
+// Draws the first len characters of a layout in the colors of font, returning
+// the height of the lines touched.
+uint32_t font_draw_layout(font_t *font, const text_layout_t *layout, uint32_t len, int32_t x, int32_t y, SDL_Surface *target){
+  uint32_t h = layout->face->h;
+  uint32_t total_height = 0;
+  for(ptrdiff_t i=0; i<arrlen(layout->lines); i++){
+    const text_line_t *line = &layout->lines[i];
+    if(line->start > len){ break; }
+    uint32_t n = (len - line->start < line->len) ? len - line->start : line->len;
+    font_draw_partial_string(font, &(layout->string[line->start]), n, x, y + total_height, target);
+    total_height += h;
+  }
   return total_height;
 }
 
-int32_t font_wrap_partial_string(font_t *font, const char *string, uint32_t len, uint32_t x, uint32_t y, uint32_t w, SDL_Surface *target){
-  if(string == NULL){ return 0; }
-  char temp[STRING_BUFFER_SIZE];
-
-  if(len >= strlen(string)){
-    return font_wrap_string(font, string, x, y, w, target);
-  }else{
-    strncpy(temp, string, len);
-    temp[len] = '\0';
-    return font_wrap_string(font, temp, x, y, w, target);
+// Draws characters from up to to of a layout where they fall in the whole
+// text. Revealing text a few characters at a time this way paints each glyph
+// once, in the order drawing the text whole would, so the pixels match.
+void font_draw_layout_range(font_t *font, const text_layout_t *layout, uint32_t from, uint32_t to, int32_t x, int32_t y, SDL_Surface *target){
+  const font_face_t *face = layout->face;
+  for(ptrdiff_t i=0; i<arrlen(layout->lines); i++){
+    const text_line_t *line = &layout->lines[i];
+    if(line->start >= to){ break; }
+    if(line->start + line->len <= from){ continue; }
+    uint32_t a = from > line->start ? from : line->start;
+    uint32_t b = to < line->start + line->len ? to : line->start + line->len;
+    int32_t pen = x;
+    for(uint32_t k=line->start; k<a; k++){
+      const glyph_t *g = &face->glyphs[(uint8_t)layout->string[k]];
+      if(g->w > 0){ pen += glyph_advance(g); }
+    }
+    font_draw_partial_string(font, &layout->string[a], b - a, pen, y + i*face->h, target);
   }
 }
 
-void font_draw_all_glyphs(font_t *font, uint32_t x, uint32_t y, SDL_Surface *target){
-  const char *string = glyph_order;
-  SDL_Rect target_rect;
-  target_rect.x = x;
-  target_rect.y = y;
-  for(uint32_t i=0; i<strlen(string); i++){
-    uint8_t ascii_code = (int)string[i];
+// Index of the line holding character index, or of the last line if the
+// text ends before it.
+uint32_t font_layout_line_at(const text_layout_t *layout, uint32_t index){
+  ptrdiff_t i = 0;
+  while(i+1 < arrlen(layout->lines) && layout->lines[i+1].start <= index){ i++; }
+  return i;
+}
+
+uint32_t font_wrap_string(font_t *font, const char *string, int32_t x, int32_t y, uint32_t w, SDL_Surface *target){
+  if(string == NULL){ return 0; }
+  return font_draw_layout(font, font_layout(font, string, w), UINT32_MAX, x, y, target);
+}
+
+int32_t font_wrap_partial_string(font_t *font, const char *string, uint32_t len, int32_t x, int32_t y, uint32_t w, SDL_Surface *target){
+  if(string == NULL){ return 0; }
+  return font_draw_layout(font, font_layout(font, string, w), len, x, y, target);
+}
+
+void font_draw_all_glyphs(font_t *font, int32_t x, int32_t y, SDL_Surface *target){
+  int32_t pen = x;
+  for(const char *c=glyph_order; *c!='\0'; c++){
+    uint8_t ascii_code = (uint8_t)*c;
 
-    if(font->glyphs[ascii_code] != NULL){
-      SDL_BlitSurface(font->glyphs[ascii_code], NULL, target, &target_rect);
-      target_rect.x += font->glyphs[ascii_code]->w;
-      target_rect.x += 4;
+    if(font->face->glyphs[ascii_code].w > 0){
+      font_draw_glyph(font, ascii_code, pen, y, target);
+      pen += font->face->glyphs[ascii_code].w + 4;
     }
   }
 }
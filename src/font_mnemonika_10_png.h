@@ -1,141 +0,0 @@
-unsigned char font_mnemonika_10_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0x00, 0x0b,
-  0x08, 0x03, 0x00, 0x00, 0x00, 0x10, 0x9e, 0xb3, 0x99, 0x00, 0x00, 0x00,
-  0x01, 0x73, 0x52, 0x47, 0x42, 0x01, 0xd9, 0xc9, 0x2c, 0x7f, 0x00, 0x00,
-  0x00, 0x04, 0x67, 0x41, 0x4d, 0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc,
-  0x61, 0x05, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00,
-  0x7a, 0x26, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
-  0x80, 0xe8, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0xea, 0x60, 0x00, 0x00,
-  0x3a, 0x98, 0x00, 0x00, 0x17, 0x70, 0x9c, 0xba, 0x51, 0x3c, 0x00, 0x00,
-  0x00, 0x12, 0x50, 0x4c, 0x54, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-  0xf1, 0x88, 0xbe, 0x47, 0x00, 0x00, 0x00, 0x01, 0x74, 0x52, 0x4e, 0x53,
-  0x00, 0x40, 0xe6, 0xd8, 0x66, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59,
-  0x73, 0x00, 0x00, 0x0b, 0x13, 0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a,
-  0x9c, 0x18, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 0x07, 0xe9,
-  0x07, 0x06, 0x10, 0x39, 0x3b, 0xc9, 0x7d, 0xa4, 0xc8, 0x00, 0x00, 0x05,
-  0xa0, 0x49, 0x44, 0x41, 0x54, 0x68, 0xde, 0xb5, 0x5a, 0x09, 0x8e, 0xe4,
-  0x30, 0x08, 0x04, 0xb9, 0xf9, 0xff, 0x97, 0x77, 0xa6, 0x13, 0x43, 0x51,
-  0x80, 0x93, 0x95, 0x76, 0x5b, 0x23, 0x85, 0x38, 0xf8, 0xc2, 0x94, 0xb9,
-  0x46, 0xd6, 0x47, 0x7e, 0x7e, 0x1f, 0x7f, 0x5c, 0xcf, 0xff, 0x4a, 0xf8,
-  0xbb, 0xb7, 0x5e, 0x5f, 0xfc, 0xad, 0x76, 0x4b, 0x34, 0x75, 0xe3, 0x66,
-  0x9c, 0x61, 0xee, 0xd9, 0x35, 0x36, 0xf3, 0x96, 0xa6, 0xe3, 0x60, 0xb0,
-  0x84, 0x8f, 0xf4, 0xbd, 0xa6, 0x65, 0x1c, 0xd7, 0xd3, 0x2d, 0xa3, 0xdb,
-  0xca, 0x38, 0xcf, 0x79, 0xc6, 0x97, 0x22, 0x38, 0xb3, 0x55, 0x21, 0x3c,
-  0x9c, 0x40, 0x4f, 0xbf, 0x9b, 0xe3, 0xe9, 0x4c, 0x9f, 0xe7, 0x29, 0x63,
-  0x10, 0x0c, 0x60, 0x07, 0x5b, 0x67, 0xfd, 0xe5, 0xd3, 0x1c, 0xc3, 0xee,
-  0x0a, 0x9f, 0xf7, 0xa8, 0x3e, 0xde, 0xcd, 0xfe, 0x11, 0xea, 0x29, 0xeb,
-  0x5a, 0xd0, 0xcf, 0x43, 0x55, 0x7f, 0x1e, 0xfa, 0xfd, 0x15, 0x42, 0xb0,
-  0x45, 0x0a, 0x8f, 0x24, 0x42, 0x52, 0x8b, 0x4f, 0xb0, 0x89, 0x18, 0xee,
-  0xdb, 0x7a, 0x0f, 0x82, 0x3c, 0xbb, 0xdd, 0x07, 0x42, 0x66, 0x67, 0xd4,
-  0x78, 0x71, 0xca, 0xd7, 0x85, 0xa3, 0xd1, 0xc0, 0x5d, 0x23, 0xaf, 0x60,
-  0x09, 0x6c, 0x25, 0xaf, 0xa9, 0xeb, 0xe7, 0xa4, 0x2f, 0x01, 0x46, 0xe4,
-  0xd5, 0x0c, 0xcb, 0x58, 0xf2, 0x8a, 0x5a, 0x59, 0x08, 0xf3, 0xae, 0x9e,
-  0x37, 0xbe, 0x04, 0x76, 0xa9, 0xd3, 0xf1, 0x4e, 0x14, 0xb3, 0x85, 0xae,
-  0xac, 0xf9, 0xd3, 0x9e, 0x49, 0xa0, 0x55, 0xe6, 0x79, 0x4b, 0xd3, 0x71,
-  0x79, 0x0d, 0x29, 0xd4, 0x3c, 0xd0, 0x9b, 0x7b, 0xe1, 0x5a, 0x42, 0x54,
-  0x0b, 0x0f, 0x7e, 0x15, 0x0d, 0x45, 0xad, 0x4b, 0xbc, 0x8b, 0x51, 0xc0,
-  0xe7, 0x70, 0x7f, 0x85, 0x69, 0xec, 0x3b, 0x92, 0xfd, 0xfc, 0x88, 0xf8,
-  0xfd, 0x92, 0x5a, 0xb4, 0xf0, 0x28, 0x10, 0x9a, 0x5a, 0x1a, 0x10, 0xde,
-  0x1c, 0x76, 0xef, 0xf6, 0x3b, 0x48, 0x80, 0xc8, 0x45, 0x1d, 0x03, 0xa9,
-  0x06, 0xb3, 0x6b, 0xf4, 0xf7, 0xc3, 0xde, 0xa9, 0x6d, 0x39, 0xec, 0x25,
-  0xeb, 0x1b, 0x10, 0x82, 0x5e, 0x98, 0x56, 0xd1, 0x9a, 0xd1, 0x7d, 0xb2,
-  0x97, 0x01, 0x7a, 0x60, 0x01, 0xc2, 0xcd, 0xbd, 0x05, 0x91, 0x78, 0xf6,
-  0x30, 0x59, 0x95, 0xb4, 0xde, 0x37, 0xe9, 0x6b, 0xa5, 0x7c, 0x26, 0x18,
-  0xb1, 0x27, 0xfb, 0xfe, 0x74, 0x79, 0x6e, 0x29, 0xde, 0x67, 0xd9, 0x1c,
-  0xef, 0x4c, 0x01, 0xdb, 0x35, 0xca, 0xf5, 0x95, 0x9e, 0xf9, 0x93, 0xec,
-  0xc6, 0x68, 0x55, 0xd1, 0x79, 0x5e, 0x6e, 0x1a, 0x97, 0x87, 0x03, 0x76,
-  0x63, 0xff, 0x72, 0x5a, 0x4f, 0x03, 0xb7, 0x3f, 0x42, 0xc6, 0xae, 0xb3,
-  0x0d, 0x08, 0x2d, 0x54, 0x75, 0x6b, 0x5d, 0xe2, 0xdd, 0xe0, 0x99, 0x40,
-  0x78, 0xe9, 0x36, 0x82, 0x70, 0x6f, 0x7b, 0x0f, 0xa9, 0x31, 0xf6, 0x3e,
-  0xa6, 0x7d, 0x86, 0x06, 0x87, 0xe9, 0xf3, 0x0f, 0x04, 0x1a, 0x40, 0x46,
-  0x4a, 0x28, 0xab, 0x05, 0x18, 0x08, 0xc4, 0x57, 0x8b, 0x37, 0x3a, 0xbe,
-  0x6e, 0xda, 0x59, 0x10, 0x7d, 0xda, 0xec, 0xbc, 0x31, 0x1f, 0xf7, 0x8d,
-  0xe1, 0x7a, 0xa1, 0x08, 0x7e, 0xd1, 0x8d, 0x9e, 0xb8, 0x4f, 0xe2, 0x93,
-  0xcf, 0x67, 0x68, 0x49, 0x04, 0x6e, 0x54, 0x0b, 0x49, 0xf8, 0x30, 0xf7,
-  0x1f, 0xbc, 0xf1, 0x7d, 0x83, 0xbb, 0x0f, 0xf9, 0x94, 0x8b, 0x4e, 0x61,
-  0x0c, 0x60, 0xc3, 0x1e, 0xf0, 0x56, 0x59, 0xcc, 0x77, 0x14, 0xa7, 0xdb,
-  0x9c, 0xe1, 0x99, 0xa2, 0xa6, 0x58, 0x1a, 0x3d, 0xb1, 0xc9, 0xc5, 0x6e,
-  0xd0, 0x1a, 0xb7, 0xf2, 0xd3, 0x1c, 0x42, 0x2a, 0x66, 0xfd, 0x0a, 0x40,
-  0x0b, 0xb4, 0x99, 0x87, 0xe6, 0x6c, 0x55, 0x07, 0x6e, 0xfb, 0x09, 0x84,
-  0x0a, 0xd7, 0x2e, 0xde, 0xb6, 0x13, 0x08, 0xd1, 0xd6, 0x86, 0x39, 0x32,
-  0x6d, 0x2c, 0xe1, 0x16, 0x8f, 0xe8, 0x6c, 0x09, 0xd3, 0x19, 0x3e, 0x80,
-  0x30, 0xb0, 0x67, 0xa0, 0xcb, 0x01, 0xc2, 0x4b, 0x33, 0xe2, 0x92, 0x8c,
-  0x59, 0x93, 0xa8, 0x49, 0x64, 0xb7, 0x4a, 0xa2, 0x7a, 0xee, 0x31, 0x63,
-  0x86, 0x0c, 0xc2, 0x6a, 0x3e, 0x32, 0x24, 0x40, 0x69, 0x81, 0x20, 0x4d,
-  0xb0, 0x02, 0x96, 0x10, 0x3d, 0x3c, 0x59, 0x6d, 0xf7, 0x87, 0xeb, 0x0f,
-  0xde, 0x24, 0x4d, 0x69, 0x66, 0x28, 0x3d, 0x05, 0xbe, 0x24, 0x11, 0x18,
-  0x03, 0xd8, 0x88, 0x84, 0xfe, 0x95, 0x05, 0x75, 0x0d, 0x54, 0xc9, 0xda,
-  0xaf, 0x37, 0xa5, 0x99, 0xca, 0x4d, 0x20, 0x78, 0x7a, 0x6e, 0x6d, 0x0e,
-  0x67, 0x63, 0xa3, 0xe7, 0xd6, 0xb2, 0x82, 0xae, 0xc3, 0x52, 0x1c, 0x43,
-  0xc9, 0x01, 0x6a, 0xb6, 0xb1, 0x67, 0xc4, 0x8b, 0xce, 0xb4, 0xd0, 0x8a,
-  0x70, 0x44, 0xd5, 0x41, 0xff, 0x65, 0x02, 0x21, 0xdc, 0x85, 0x09, 0x8c,
-  0x5b, 0xef, 0x13, 0x08, 0x93, 0xf1, 0x07, 0xc7, 0x3c, 0x81, 0x10, 0x40,
-  0xe1, 0xb3, 0x83, 0x29, 0x6a, 0xed, 0x1e, 0xae, 0xa3, 0x1a, 0x30, 0xf6,
-  0x6f, 0xd1, 0x2f, 0x42, 0x10, 0xee, 0x23, 0xa9, 0xea, 0x1d, 0x5a, 0xe4,
-  0x43, 0x88, 0xa2, 0xd1, 0xb0, 0x6a, 0x09, 0x7b, 0x10, 0x26, 0x8f, 0x15,
-  0xee, 0x07, 0x03, 0x5d, 0x30, 0x25, 0x73, 0xef, 0xba, 0x8e, 0x6a, 0x9c,
-  0xc0, 0x8b, 0x5c, 0xa0, 0x23, 0xa0, 0x7e, 0xa1, 0x90, 0xdb, 0x00, 0xe0,
-  0x5b, 0x01, 0x79, 0x96, 0x30, 0xf0, 0x25, 0xe5, 0x4b, 0x96, 0x70, 0x20,
-  0xfd, 0xad, 0xe5, 0x86, 0xb5, 0x01, 0x1c, 0xac, 0x47, 0x97, 0xdf, 0xc8,
-  0x89, 0xf2, 0x53, 0x39, 0x83, 0x30, 0x22, 0x0d, 0x04, 0x61, 0x12, 0xe0,
-  0x4b, 0x10, 0x1a, 0x05, 0x2a, 0x78, 0xb1, 0x4e, 0x20, 0x74, 0x1a, 0x2c,
-  0x71, 0xa2, 0x15, 0x9d, 0x48, 0x54, 0x1d, 0x8e, 0x2e, 0x5a, 0x10, 0x46,
-  0x78, 0x95, 0xdd, 0x52, 0x84, 0xa2, 0x86, 0xaa, 0x31, 0x79, 0xcd, 0x3e,
-  0x80, 0x30, 0x1c, 0xbe, 0x64, 0xc1, 0xa4, 0x13, 0x8d, 0x90, 0xfc, 0x5e,
-  0x58, 0x42, 0xb4, 0xf0, 0x97, 0x25, 0x34, 0x55, 0x65, 0x10, 0x22, 0x41,
-  0x9e, 0xf5, 0x1e, 0xbe, 0x5c, 0x89, 0x33, 0x08, 0xb3, 0x89, 0x45, 0xf7,
-  0xaf, 0x9a, 0x01, 0x36, 0x93, 0x66, 0xca, 0xfe, 0x86, 0x66, 0xf0, 0xd6,
-  0x98, 0x50, 0xdc, 0xd5, 0x95, 0x3c, 0x47, 0x55, 0x96, 0x5e, 0xf9, 0x0c,
-  0x35, 0x49, 0x19, 0x39, 0x9d, 0xee, 0xc1, 0x7c, 0xc6, 0x2a, 0x5b, 0x2f,
-  0x8c, 0x70, 0x77, 0x46, 0x11, 0xcc, 0x96, 0x90, 0x97, 0x8d, 0x83, 0x1c,
-  0x2c, 0x21, 0xc4, 0xb4, 0x49, 0x0c, 0xd6, 0x0c, 0x58, 0x4c, 0xb6, 0x25,
-  0xf3, 0x71, 0x02, 0x21, 0x6e, 0xb8, 0xb3, 0x84, 0x70, 0x21, 0x28, 0x9e,
-  0x37, 0x83, 0x10, 0x2c, 0x86, 0x60, 0x80, 0x28, 0x98, 0x47, 0x38, 0x5b,
-  0x42, 0x0c, 0xf6, 0x30, 0x8d, 0x98, 0xe3, 0x9b, 0x0a, 0xc2, 0xe2, 0x6a,
-  0x2a, 0x86, 0x42, 0xee, 0x0f, 0x8d, 0x20, 0x64, 0x9e, 0x12, 0x13, 0xa6,
-  0x84, 0xd3, 0x2d, 0x05, 0x2d, 0xd9, 0x01, 0x32, 0x0f, 0x1d, 0x08, 0x0d,
-  0x13, 0x25, 0x29, 0xe7, 0x83, 0xf8, 0x67, 0x9c, 0x46, 0x46, 0xa4, 0x44,
-  0x12, 0xd5, 0x9f, 0x6e, 0xee, 0x1c, 0xcf, 0x15, 0xf5, 0xe1, 0x90, 0x28,
-  0xb9, 0xac, 0x42, 0xd1, 0x4a, 0x8d, 0x5d, 0x80, 0xd3, 0xd0, 0x89, 0x94,
-  0x1c, 0x4a, 0x15, 0xff, 0xe3, 0x86, 0x95, 0x16, 0x93, 0x63, 0xa8, 0xb2,
-  0x46, 0x91, 0xec, 0x29, 0x9c, 0x7b, 0x19, 0x13, 0x8a, 0x3c, 0xc4, 0x84,
-  0x42, 0x56, 0xb9, 0xfa, 0xe7, 0x14, 0x9f, 0xd5, 0x01, 0x6b, 0x93, 0x15,
-  0xf0, 0x27, 0x80, 0x17, 0xdb, 0x3b, 0xc5, 0x9e, 0x42, 0x9b, 0xe8, 0xd3,
-  0x09, 0x60, 0x55, 0x30, 0x0c, 0x4c, 0x9e, 0x26, 0x5c, 0x01, 0x25, 0x26,
-  0x24, 0x10, 0x4e, 0x96, 0xf0, 0xdb, 0x63, 0x2c, 0x51, 0x40, 0x68, 0x9a,
-  0x90, 0x8e, 0x45, 0x0b, 0xc1, 0x58, 0x4e, 0xb5, 0xe7, 0xe9, 0x33, 0xf1,
-  0x94, 0x1d, 0xb5, 0x62, 0x09, 0x93, 0x73, 0x94, 0x01, 0x1d, 0x4e, 0x65,
-  0xd3, 0x8c, 0x02, 0x35, 0x03, 0x2b, 0x6e, 0x6d, 0x62, 0x06, 0xa3, 0xdc,
-  0x9a, 0xde, 0x2d, 0x19, 0x5f, 0xe5, 0x93, 0xab, 0x89, 0xc1, 0xf8, 0x02,
-  0xb7, 0x19, 0xc6, 0x6a, 0xa5, 0x67, 0x72, 0x18, 0x4b, 0xa8, 0x62, 0x8d,
-  0x8c, 0xd1, 0x0e, 0x23, 0x30, 0xd1, 0xe2, 0xc6, 0x15, 0x6c, 0x10, 0x96,
-  0x94, 0xe8, 0x3e, 0x27, 0x6b, 0xf2, 0x7e, 0xcd, 0x90, 0xe2, 0x24, 0xe7,
-  0x29, 0x3b, 0x8a, 0x4e, 0x44, 0x9b, 0x87, 0xcc, 0x19, 0x4c, 0x95, 0x7c,
-  0xe4, 0x16, 0xab, 0xef, 0x62, 0xde, 0x94, 0xb5, 0xd8, 0x4a, 0xa4, 0xa8,
-  0xa4, 0x4d, 0x16, 0xd6, 0x14, 0x74, 0xc1, 0x9a, 0x24, 0x44, 0xca, 0x8e,
-  0xe2, 0x65, 0x9a, 0x8d, 0x1f, 0xfa, 0x9b, 0xd2, 0x66, 0x47, 0x39, 0x8a,
-  0x1c, 0x63, 0xc2, 0xbd, 0xf3, 0x25, 0xd5, 0xd4, 0x72, 0x35, 0x0a, 0x2b,
-  0x60, 0x3d, 0x4f, 0xca, 0xad, 0xcb, 0x01, 0x7b, 0x4d, 0xe9, 0xc5, 0x4d,
-  0x53, 0x4a, 0xd2, 0x43, 0x6e, 0x52, 0xb9, 0x62, 0x87, 0x79, 0xf8, 0xa6,
-  0xde, 0x87, 0x95, 0x48, 0xcc, 0xc5, 0x6b, 0x5b, 0xa2, 0xc0, 0xab, 0xa7,
-  0x16, 0x3a, 0x53, 0xed, 0x13, 0x23, 0x60, 0x1b, 0x4b, 0x64, 0xc6, 0xb5,
-  0x2e, 0xa1, 0xf2, 0x14, 0xf7, 0x04, 0x3b, 0x1e, 0x85, 0x12, 0xcc, 0x56,
-  0x37, 0x32, 0xd6, 0xa6, 0x44, 0x41, 0xbb, 0x42, 0xff, 0xc3, 0x75, 0x8f,
-  0x2a, 0xbe, 0x65, 0x41, 0x69, 0x7c, 0xd5, 0x5a, 0x44, 0x2c, 0x67, 0x35,
-  0x0b, 0xa1, 0x2d, 0xe0, 0x0d, 0x75, 0x42, 0xe1, 0x82, 0xb4, 0x64, 0xd7,
-  0x53, 0x35, 0x93, 0x54, 0xd1, 0x91, 0xb4, 0x2a, 0xd8, 0x7a, 0x57, 0x27,
-  0x14, 0x16, 0x6a, 0x57, 0x27, 0x14, 0x49, 0xc7, 0x99, 0x8b, 0x6b, 0x50,
-  0x16, 0x6c, 0xea, 0x84, 0xa5, 0xb2, 0x38, 0x66, 0x47, 0xab, 0x25, 0x94,
-  0x57, 0xe0, 0xf9, 0x57, 0xc4, 0x7a, 0x2c, 0x2d, 0x97, 0x1a, 0xf7, 0xea,
-  0x2b, 0xd2, 0xa5, 0x79, 0x9d, 0xeb, 0xf2, 0x6f, 0x4b, 0xe2, 0xc3, 0x7f,
-  0x19, 0xd0, 0xe9, 0x13, 0x57, 0xf9, 0x47, 0x81, 0xf5, 0x50, 0x44, 0x67,
-  0x87, 0x3d, 0x17, 0xd1, 0x4f, 0x2b, 0xfb, 0xfb, 0x62, 0xbd, 0x4e, 0x37,
-  0xe4, 0x5b, 0x11, 0x9c, 0xd9, 0x58, 0x08, 0x8f, 0x27, 0xd0, 0xd3, 0xc4,
-  0x0a, 0x62, 0xe8, 0xff, 0xfb, 0xe3, 0x85, 0x20, 0x9e, 0xe9, 0x11, 0x06,
-  0x70, 0x9c, 0xf4, 0x32, 0x1c, 0xf0, 0x6a, 0xd4, 0xfb, 0xbc, 0xc2, 0xf5,
-  0x07, 0x68, 0x61, 0x35, 0xc0, 0x46, 0x2c, 0x82, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int font_mnemonika_10_png_len = 1653;
@@ -1,134 +0,0 @@
-unsigned char font_small_8_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x03, 0x2e, 0x00, 0x00, 0x00, 0x09,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0xd4, 0xf2, 0x78, 0xb8, 0x00, 0x00, 0x00,
-  0x01, 0x73, 0x52, 0x47, 0x42, 0x01, 0xd9, 0xc9, 0x2c, 0x7f, 0x00, 0x00,
-  0x00, 0x04, 0x67, 0x41, 0x4d, 0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc,
-  0x61, 0x05, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00,
-  0x7a, 0x26, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
-  0x80, 0xe8, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0xea, 0x60, 0x00, 0x00,
-  0x3a, 0x98, 0x00, 0x00, 0x17, 0x70, 0x9c, 0xba, 0x51, 0x3c, 0x00, 0x00,
-  0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13, 0x00, 0x00,
-  0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c, 0x18, 0x00, 0x00, 0x00, 0x07, 0x74,
-  0x49, 0x4d, 0x45, 0x07, 0xe9, 0x07, 0x09, 0x02, 0x01, 0x36, 0xe7, 0x92,
-  0x03, 0xc6, 0x00, 0x00, 0x05, 0x77, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda,
-  0xed, 0x5b, 0xed, 0x72, 0xdc, 0x30, 0x08, 0x14, 0x99, 0x7b, 0xff, 0x57,
-  0xa6, 0x3f, 0x92, 0x4b, 0x6c, 0x59, 0x82, 0x05, 0x56, 0x72, 0xae, 0xb9,
-  0x9b, 0x69, 0xa7, 0xa9, 0x38, 0xc4, 0xc7, 0x02, 0x2b, 0xd9, 0x11, 0x6d,
-  0xaa, 0xa2, 0xd2, 0x5a, 0x6b, 0xad, 0x49, 0xfb, 0xfc, 0x87, 0x36, 0x6d,
-  0xad, 0x35, 0x15, 0x6d, 0x97, 0xb5, 0xe7, 0xe7, 0x2d, 0xb3, 0x5e, 0x66,
-  0xd5, 0x3a, 0x62, 0x1b, 0xea, 0xc3, 0x0a, 0x39, 0x96, 0xff, 0x0c, 0x3d,
-  0xd9, 0x35, 0xa6, 0x0f, 0x7f, 0x11, 0xdb, 0x55, 0x99, 0x55, 0x79, 0x63,
-  0x62, 0xfd, 0x9d, 0xd7, 0x9a, 0xcc, 0x7b, 0x7e, 0xbc, 0xb1, 0xf1, 0xc6,
-  0xcf, 0xeb, 0xf8, 0xff, 0x9b, 0x62, 0x50, 0x99, 0x0f, 0xd1, 0xd9, 0x90,
-  0xd9, 0xeb, 0xb7, 0x71, 0xc3, 0xbb, 0xec, 0x99, 0xe4, 0xf3, 0x31, 0x14,
-  0xf8, 0xf9, 0x59, 0xbb, 0x35, 0x75, 0x64, 0x14, 0xd0, 0xe3, 0xc9, 0x68,
-  0x52, 0xe6, 0xf9, 0x77, 0x75, 0xaf, 0x8c, 0x1e, 0xa6, 0x4c, 0x65, 0x5d,
-  0xbb, 0x1c, 0xf5, 0xb2, 0xfa, 0x25, 0xeb, 0xfb, 0x88, 0xfa, 0x50, 0x93,
-  0xd3, 0xa1, 0xdc, 0x8f, 0xb4, 0xad, 0x17, 0xd3, 0x27, 0x60, 0x9c, 0xc6,
-  0xf1, 0xb8, 0xae, 0xe9, 0x61, 0xcd, 0xce, 0x4f, 0x3e, 0xc7, 0x08, 0x26,
-  0x23, 0xb1, 0x15, 0x92, 0xbd, 0x5a, 0xb0, 0xa7, 0x01, 0x31, 0x67, 0xf8,
-  0xe4, 0x63, 0xbc, 0xb2, 0x37, 0xf2, 0x5d, 0x16, 0x36, 0x5e, 0x43, 0xe6,
-  0x9c, 0x93, 0x9d, 0xb6, 0xfc, 0x8e, 0xf8, 0x78, 0xb5, 0xaa, 0xc9, 0xd9,
-  0xb0, 0x4a, 0x0f, 0x4b, 0x46, 0xc3, 0x32, 0xf3, 0xda, 0x51, 0xe2, 0x3e,
-  0x02, 0xf6, 0x0e, 0x2d, 0xec, 0xb7, 0x32, 0x5f, 0x19, 0x3e, 0x94, 0xb3,
-  0x87, 0x95, 0x57, 0x2c, 0x27, 0xba, 0x71, 0x3f, 0x5f, 0x26, 0xbb, 0x66,
-  0xf1, 0x89, 0xd9, 0xf7, 0xac, 0x99, 0x31, 0xeb, 0x3b, 0x1e, 0x07, 0xf7,
-  0x30, 0xe9, 0xd7, 0x62, 0xd5, 0x87, 0x58, 0x6d, 0xc7, 0x63, 0x6a, 0xd6,
-  0xc6, 0x47, 0xc3, 0x3f, 0x9f, 0xa7, 0x1d, 0x55, 0x77, 0xfd, 0x20, 0xa3,
-  0x09, 0x99, 0xef, 0x35, 0x63, 0xaf, 0x6f, 0x1d, 0x9d, 0x2e, 0x6f, 0x2f,
-  0x96, 0x1e, 0x5d, 0xe5, 0x3b, 0x90, 0x83, 0xfe, 0x4f, 0xc8, 0x1f, 0xc4,
-  0x47, 0xc4, 0x87, 0x4e, 0x57, 0x56, 0xee, 0x62, 0xa7, 0x95, 0xab, 0x01,
-  0x06, 0x4d, 0xff, 0xbb, 0x98, 0x45, 0x30, 0x66, 0x62, 0xbd, 0x90, 0xbf,
-  0x51, 0x1e, 0x1b, 0x18, 0xbb, 0x14, 0x16, 0x18, 0x98, 0x02, 0x75, 0x2a,
-  0xea, 0xd7, 0x6a, 0x9f, 0xbc, 0x7a, 0x0f, 0xe6, 0x23, 0xf2, 0x5d, 0xcf,
-  0x7f, 0x24, 0xce, 0xab, 0xf4, 0xe8, 0x2a, 0xbb, 0x9d, 0x5a, 0x53, 0x92,
-  0x2d, 0xba, 0x41, 0x57, 0x46, 0xc6, 0x9b, 0x1f, 0xa1, 0xbe, 0xba, 0x41,
-  0x0f, 0x4b, 0x06, 0xea, 0xdb, 0x9e, 0x8e, 0xd9, 0x1c, 0xc8, 0xec, 0x13,
-  0xe8, 0x0b, 0x68, 0x7f, 0x2f, 0xc7, 0x87, 0xc5, 0x87, 0xd8, 0xf8, 0x61,
-  0xc6, 0x1b, 0x9d, 0x93, 0x3b, 0xf6, 0x43, 0x63, 0x50, 0xc1, 0x60, 0x64,
-  0x1d, 0x9c, 0xc1, 0x31, 0xf2, 0x00, 0xf0, 0xd9, 0xe8, 0x5a, 0xc6, 0x07,
-  0x90, 0xa3, 0x64, 0x79, 0x94, 0x59, 0x1b, 0x1f, 0xac, 0x80, 0x3d, 0xd7,
-  0x45, 0xa4, 0x89, 0x88, 0x69, 0xac, 0x27, 0x33, 0x73, 0xe2, 0x72, 0x59,
-  0xf0, 0xa5, 0x47, 0x44, 0xdc, 0xbd, 0xac, 0x8f, 0x27, 0xc3, 0xf2, 0x0b,
-  0x90, 0x09, 0x1d, 0x4c, 0xb2, 0xfe, 0x78, 0xb6, 0x79, 0x3e, 0x20, 0xa0,
-  0x45, 0xe5, 0x32, 0x45, 0xeb, 0x61, 0xe7, 0xe8, 0xfb, 0x4c, 0xee, 0xa9,
-  0xc3, 0xc3, 0x8e, 0xf5, 0xdd, 0xc2, 0xa1, 0xc5, 0x1d, 0x54, 0x8e, 0x7d,
-  0x8a, 0x62, 0xc1, 0x3a, 0xbc, 0x05, 0xf4, 0x78, 0xa4, 0x1e, 0x1e, 0xc0,
-  0x06, 0x36, 0x59, 0x3e, 0x99, 0xd8, 0xb7, 0xf2, 0x1d, 0x39, 0xc4, 0x00,
-  0x03, 0xb3, 0x4c, 0x40, 0x76, 0x10, 0x19, 0x67, 0xa0, 0xc1, 0x39, 0xd9,
-  0x49, 0x84, 0xd0, 0xde, 0xb3, 0x8b, 0x08, 0x45, 0x66, 0x0c, 0xa2, 0xc7,
-  0xc3, 0x6f, 0x55, 0x0f, 0x4b, 0x06, 0xf9, 0x3c, 0xbf, 0x8b, 0xc4, 0x67,
-  0xc7, 0x07, 0x9d, 0x47, 0x11, 0xae, 0xc3, 0xca, 0x3b, 0x32, 0xd3, 0x2b,
-  0x79, 0x3f, 0xae, 0x55, 0xf3, 0xca, 0xe4, 0x8d, 0xac, 0x0f, 0x8a, 0x57,
-  0x2b, 0x3e, 0x15, 0x2e, 0xba, 0x23, 0x94, 0xc8, 0x1a, 0xe8, 0x9f, 0x46,
-  0x6b, 0x38, 0xcb, 0x73, 0x40, 0x1e, 0xa5, 0x91, 0xda, 0x78, 0x44, 0x81,
-  0x81, 0x10, 0x46, 0xcf, 0x58, 0x4f, 0xa6, 0x6f, 0x30, 0x1e, 0xd9, 0x40,
-  0xf4, 0x7c, 0xc9, 0x68, 0x3b, 0xbf, 0x40, 0x05, 0xdb, 0xec, 0xed, 0x55,
-  0x24, 0xb3, 0xc3, 0x22, 0x1f, 0xed, 0xb5, 0xa3, 0x40, 0xbc, 0x1c, 0x03,
-  0xc4, 0xba, 0x65, 0x8a, 0xa2, 0xd3, 0x77, 0x7e, 0xf4, 0x1f, 0x18, 0x84,
-  0x28, 0x76, 0x40, 0x1f, 0x64, 0xf0, 0xb3, 0x32, 0xe2, 0x3b, 0xdb, 0x7b,
-  0xe0, 0xa3, 0x58, 0x07, 0x2b, 0xe4, 0x16, 0x65, 0x86, 0x7f, 0xc0, 0x7f,
-  0xef, 0x49, 0xeb, 0x25, 0x9e, 0xe0, 0x81, 0xf0, 0x16, 0x9f, 0x10, 0xcc,
-  0x66, 0x70, 0x8d, 0xd6, 0x85, 0xd7, 0x6f, 0xfa, 0x18, 0xb0, 0xf4, 0x64,
-  0x7d, 0x45, 0x7a, 0xec, 0x4e, 0xe2, 0x19, 0x9d, 0x53, 0x0c, 0xd2, 0x8d,
-  0xc6, 0x08, 0xa9, 0x79, 0xc0, 0x9e, 0x72, 0x20, 0xbb, 0xbd, 0x24, 0x2b,
-  0x83, 0xd8, 0xed, 0xf8, 0xde, 0xf7, 0x4a, 0x01, 0xe5, 0x2a, 0xf1, 0x0b,
-  0xd5, 0x69, 0x96, 0xeb, 0x24, 0x73, 0x51, 0xea, 0x49, 0x28, 0xff, 0x98,
-  0xc8, 0x8c, 0x5e, 0xbf, 0xa1, 0x60, 0x8d, 0x95, 0x13, 0x06, 0xbf, 0x2a,
-  0xd4, 0x99, 0x89, 0xc1, 0xae, 0xaf, 0x2b, 0x1a, 0x3b, 0x62, 0x5f, 0x74,
-  0x0f, 0x02, 0xdd, 0xda, 0xd0, 0xbf, 0x04, 0x6f, 0x93, 0xec, 0xa5, 0x44,
-  0xd5, 0x1e, 0xcb, 0xc6, 0x47, 0x31, 0x90, 0x92, 0x19, 0x84, 0xc7, 0x53,
-  0x94, 0x65, 0x30, 0x32, 0xb8, 0x8b, 0x03, 0x5e, 0x3e, 0x97, 0x34, 0x44,
-  0x12, 0x91, 0xbd, 0x18, 0x44, 0x3e, 0x73, 0xb0, 0x59, 0x5d, 0x48, 0xa3,
-  0x5b, 0xcf, 0x59, 0x0e, 0x01, 0x5b, 0xe5, 0x47, 0xed, 0x95, 0x68, 0x4d,
-  0xf2, 0x15, 0x22, 0x1c, 0xd5, 0x9b, 0xc0, 0x01, 0xce, 0xa1, 0x5b, 0x0f,
-  0xcb, 0x6e, 0xa7, 0x79, 0x50, 0x19, 0x20, 0x4a, 0xbe, 0xd0, 0xe1, 0x54,
-  0x21, 0xc1, 0x5e, 0xbc, 0xd1, 0xe1, 0xc4, 0xf0, 0x69, 0x25, 0x39, 0x7a,
-  0xa5, 0x8f, 0xd5, 0xf7, 0x46, 0xb5, 0xb4, 0x3a, 0x36, 0xec, 0x9c, 0x56,
-  0xb1, 0x16, 0xc1, 0x74, 0xf5, 0x52, 0x8f, 0x45, 0x2c, 0x07, 0x37, 0xab,
-  0x92, 0x9d, 0x03, 0x91, 0xcb, 0x4a, 0xa0, 0x1f, 0x46, 0x7a, 0xe9, 0xb2,
-  0xf8, 0xb1, 0x7c, 0x4f, 0xe4, 0x42, 0x00, 0x52, 0x9c, 0xf6, 0x7f, 0x55,
-  0x5f, 0x04, 0x6b, 0x43, 0x18, 0x7a, 0x2c, 0x9e, 0xe6, 0xd5, 0x59, 0xd0,
-  0xef, 0x08, 0x16, 0x5d, 0x92, 0x6d, 0xd8, 0x1d, 0xc5, 0xe9, 0x14, 0xbf,
-  0x5e, 0xbc, 0x9d, 0xc3, 0x95, 0x26, 0xb1, 0x31, 0xb3, 0x47, 0xd0, 0xfa,
-  0x49, 0xda, 0xf3, 0xcd, 0xcd, 0x47, 0x35, 0xfb, 0x88, 0x02, 0xcc, 0xbb,
-  0xe5, 0xf3, 0x86, 0x1c, 0xeb, 0x66, 0x00, 0x21, 0xf0, 0xcc, 0x9b, 0x37,
-  0xc0, 0x66, 0x25, 0xde, 0x8a, 0x94, 0x0e, 0x1e, 0x19, 0x72, 0x79, 0x04,
-  0x19, 0x42, 0x2e, 0x01, 0xf2, 0x3d, 0x2a, 0xf4, 0xe5, 0xdd, 0xb4, 0x8f,
-  0x71, 0xa2, 0xa1, 0xb8, 0xc3, 0x04, 0x79, 0x0a, 0x68, 0xe4, 0xeb, 0xd4,
-  0x84, 0x2b, 0xe4, 0x84, 0x71, 0x03, 0x85, 0x1c, 0x30, 0x91, 0xbd, 0x8e,
-  0x4f, 0x5b, 0x00, 0x9c, 0x8a, 0x85, 0x99, 0xea, 0xe1, 0x3f, 0x70, 0xa0,
-  0xbc, 0x75, 0xf0, 0x57, 0x7a, 0x16, 0xf9, 0x09, 0xb0, 0x20, 0xbd, 0x24,
-  0xdb, 0xd7, 0x92, 0x87, 0x04, 0xb1, 0xf4, 0xa0, 0x3d, 0xae, 0x4a, 0x84,
-  0x58, 0x87, 0x36, 0x46, 0x1d, 0xa2, 0xb6, 0x04, 0x2e, 0xb7, 0x64, 0x25,
-  0x69, 0x8f, 0x70, 0x06, 0xe6, 0x8c, 0x06, 0xfd, 0x56, 0x96, 0x6f, 0x95,
-  0xa7, 0x68, 0xac, 0x37, 0x18, 0x58, 0x71, 0x8c, 0xf4, 0x20, 0xe4, 0xd2,
-  0x83, 0xf9, 0x76, 0x06, 0x0b, 0xfb, 0x08, 0x16, 0x57, 0x61, 0x06, 0x21,
-  0xed, 0x89, 0xb7, 0x40, 0x4e, 0xf6, 0x81, 0xfe, 0x49, 0x24, 0xee, 0x89,
-  0xdc, 0x45, 0x0f, 0x7b, 0xc8, 0x25, 0x83, 0xa4, 0x0e, 0x2e, 0x84, 0xd7,
-  0x05, 0x7a, 0xd2, 0xe6, 0x16, 0x75, 0x60, 0x4d, 0xb2, 0x7b, 0x21, 0x24,
-  0x12, 0x49, 0x9c, 0xb3, 0x57, 0xc8, 0xf7, 0x68, 0x03, 0x2c, 0xe6, 0x08,
-  0x25, 0xd3, 0x27, 0x39, 0x47, 0x3e, 0x44, 0xd0, 0x8f, 0x76, 0x15, 0x1a,
-  0xdc, 0x25, 0xc6, 0x49, 0x5d, 0xa3, 0x5c, 0x41, 0x78, 0x01, 0xf7, 0xab,
-  0xb2, 0x62, 0xd3, 0xbe, 0x62, 0x8d, 0xb4, 0x45, 0x32, 0xa1, 0x43, 0x37,
-  0xf2, 0xa4, 0x35, 0xf2, 0xae, 0xf2, 0x2a, 0xbd, 0xc7, 0xff, 0xf7, 0x9e,
-  0xe2, 0x01, 0x7b, 0x64, 0x7a, 0x96, 0x9b, 0x57, 0xeb, 0xf7, 0xbc, 0x12,
-  0xfd, 0x24, 0x8a, 0xa1, 0x0c, 0x36, 0x24, 0xab, 0x27, 0xd2, 0x4b, 0x22,
-  0x98, 0xa8, 0xec, 0x45, 0xaa, 0x43, 0xe8, 0x02, 0x26, 0x99, 0xd3, 0x72,
-  0xce, 0xb2, 0x31, 0x8c, 0xfa, 0x14, 0xa8, 0x1b, 0x77, 0x2f, 0x72, 0x2f,
-  0x90, 0x6a, 0x9c, 0x57, 0xdb, 0x13, 0x39, 0xd4, 0x79, 0xf5, 0xc8, 0xe4,
-  0x0a, 0x68, 0xbd, 0x06, 0x6c, 0x4a, 0x61, 0xbf, 0xf2, 0xfd, 0xec, 0xef,
-  0x14, 0xb3, 0xf7, 0xa8, 0xf8, 0xc7, 0xf2, 0x8d, 0xc1, 0xa3, 0x06, 0x71,
-  0x3a, 0xc9, 0x3c, 0x82, 0x46, 0x30, 0xc8, 0x18, 0x43, 0x8e, 0xb9, 0xd7,
-  0x4e, 0xbf, 0x56, 0x5f, 0xe3, 0x8a, 0x75, 0xc2, 0xdf, 0x18, 0xd3, 0x95,
-  0x3a, 0x77, 0xe9, 0x92, 0x85, 0xb8, 0xdc, 0xe1, 0xe7, 0x6e, 0xdc, 0x52,
-  0xec, 0x01, 0x08, 0x79, 0xca, 0x8e, 0x55, 0x7a, 0x37, 0xf7, 0x3d, 0xb8,
-  0xe1, 0x1f, 0xd6, 0xb4, 0xf0, 0x4a, 0xa2, 0x6c, 0xc2, 0xe2, 0x2d, 0x3d,
-  0x76, 0x21, 0x26, 0xee, 0x88, 0xe1, 0x2b, 0xda, 0x73, 0xa7, 0xbd, 0xf2,
-  0x87, 0xe2, 0xfc, 0x3f, 0x70, 0xa2, 0xd5, 0x71, 0xda, 0x31, 0x03, 0x90,
-  0x1e, 0x2e, 0x37, 0xf9, 0x47, 0xf3, 0x8d, 0xa9, 0x77, 0x76, 0xe8, 0xf9,
-  0x07, 0x07, 0x62, 0xf6, 0x08, 0x1d, 0xc2, 0x3a, 0xb4, 0x00, 0x00, 0x00,
-  0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int font_small_8_png_len = 1569;
@@ -0,0 +1,923 @@
+// Generated from font-small-8.png by tools/png2rgba.c. Do not edit; run 'make assets'.
+#pragma once
+
+const int32_t font_small_8_rgba_w = 814;
+const int32_t font_small_8_rgba_h = 9;
+uint32_t font_small_8_rgba[] = {
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff,
+  0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000,
+  0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff,
+  0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff,
+  0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff,
+  0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff,
+  0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff,
+  0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff,
+  0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff,
+  0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff,
+  0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff,
+  0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff,
+  0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff,
+  0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff,
+  0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000,
+  0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff,
+  0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff,
+  0x00ff00ff, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0x00ff00ff, 0x00ff00ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00ff00ff, 0x00ff00ff, 0xff00ffff, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff,
+  0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0xff00ffff, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0xffffffff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0xffffffff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0xffffffff, 0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff,
+  0xffffffff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x000000ff, 0xffffffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff,
+  0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff00ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff, 0x00000000, 0x00000000, 0x000000ff,
+  0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0xff00ffff
+};
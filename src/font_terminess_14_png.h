@@ -1,208 +0,0 @@
-unsigned char font_terminess_14_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x04, 0x75, 0x00, 0x00, 0x00, 0x0f,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0x6a, 0x64, 0xf3, 0x99, 0x00, 0x00, 0x00,
-  0x01, 0x73, 0x52, 0x47, 0x42, 0x01, 0xd9, 0xc9, 0x2c, 0x7f, 0x00, 0x00,
-  0x00, 0x04, 0x67, 0x41, 0x4d, 0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc,
-  0x61, 0x05, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00,
-  0x7a, 0x26, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
-  0x80, 0xe8, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0xea, 0x60, 0x00, 0x00,
-  0x3a, 0x98, 0x00, 0x00, 0x17, 0x70, 0x9c, 0xba, 0x51, 0x3c, 0x00, 0x00,
-  0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13, 0x00, 0x00,
-  0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c, 0x18, 0x00, 0x00, 0x00, 0x07, 0x74,
-  0x49, 0x4d, 0x45, 0x07, 0xe9, 0x07, 0x06, 0x0f, 0x0b, 0x0d, 0xfc, 0xcd,
-  0x81, 0x6d, 0x00, 0x00, 0x08, 0xeb, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda,
-  0xed, 0x5d, 0xe9, 0x8e, 0xdd, 0x3a, 0x08, 0x36, 0xd5, 0xbc, 0xff, 0x2b,
-  0xd3, 0x1f, 0xed, 0xd5, 0xcd, 0x71, 0xed, 0x98, 0x8f, 0xc5, 0x26, 0x39,
-  0x58, 0x1a, 0x69, 0x3a, 0x25, 0x04, 0xb3, 0x83, 0x97, 0x10, 0x37, 0x66,
-  0x62, 0x6a, 0xad, 0xb5, 0xd6, 0xa8, 0xfd, 0xfd, 0x65, 0x30, 0xb8, 0x71,
-  0x6b, 0xad, 0x31, 0x71, 0x2b, 0xf8, 0x82, 0x2f, 0xf8, 0x82, 0x2f, 0xf8,
-  0x82, 0x2f, 0xf8, 0x82, 0x2f, 0xf8, 0x82, 0x2f, 0xf8, 0x82, 0x2f, 0xf8,
-  0x82, 0x2f, 0xf8, 0x82, 0x2f, 0xf8, 0xc3, 0xf0, 0xcd, 0x67, 0x70, 0xf7,
-  0x6f, 0x12, 0xc2, 0xad, 0x9e, 0x41, 0xe1, 0x11, 0xba, 0x58, 0xf0, 0x3c,
-  0x42, 0x13, 0x01, 0xb4, 0x6b, 0x9e, 0xa1, 0x04, 0xfc, 0x8c, 0x18, 0xec,
-  0x2c, 0xd7, 0xd3, 0x73, 0x20, 0x80, 0xee, 0xa6, 0xb4, 0x1b, 0xf4, 0x1d,
-  0x74, 0x50, 0x6e, 0x99, 0x64, 0xa5, 0xb5, 0xf9, 0x96, 0x54, 0x27, 0xa3,
-  0xde, 0xc9, 0x01, 0x3e, 0xc2, 0x42, 0xab, 0xf6, 0x59, 0xc4, 0xff, 0x93,
-  0x81, 0x37, 0xa7, 0xfd, 0xcf, 0x37, 0x0d, 0x2e, 0xde, 0x6f, 0xf1, 0x87,
-  0x68, 0x3e, 0x43, 0x81, 0xf8, 0x51, 0xdc, 0x5e, 0xf9, 0x9e, 0x85, 0x7e,
-  0x12, 0xea, 0xaa, 0xc6, 0xd7, 0xb2, 0x62, 0xbe, 0x2b, 0x7a, 0x50, 0xbb,
-  0x62, 0x01, 0x1e, 0x32, 0xf2, 0xe7, 0x29, 0xfa, 0xb9, 0x03, 0x7f, 0xff,
-  0x9c, 0x87, 0x7c, 0xb3, 0xc1, 0x23, 0x7f, 0xf7, 0xae, 0xd7, 0x34, 0xf0,
-  0xbb, 0x62, 0x51, 0xd6, 0x98, 0x67, 0xa9, 0xfb, 0xc9, 0x00, 0x77, 0x3a,
-  0x0f, 0x3e, 0x25, 0x07, 0x91, 0x3f, 0xf9, 0xf1, 0x7a, 0x11, 0xf3, 0x9f,
-  0xf7, 0x11, 0x91, 0x08, 0xee, 0x83, 0x9a, 0x3f, 0xcf, 0xf0, 0xc8, 0xe8,
-  0x01, 0x78, 0x98, 0xae, 0x11, 0xee, 0xee, 0x1d, 0xa2, 0x39, 0xcc, 0xe6,
-  0x0c, 0xe2, 0x8f, 0xe6, 0x8f, 0x95, 0x9f, 0x71, 0x9a, 0xfa, 0x29, 0x23,
-  0x11, 0x1d, 0x02, 0x7d, 0xf3, 0x4e, 0x14, 0x69, 0x45, 0x8f, 0x84, 0x96,
-  0x9e, 0x6e, 0xd4, 0x6e, 0x16, 0x3c, 0xfa, 0x47, 0xc6, 0x41, 0xb2, 0x65,
-  0x40, 0x06, 0x2a, 0xf9, 0x46, 0x39, 0xc4, 0x01, 0x6f, 0xc4, 0xf3, 0x70,
-  0xd2, 0xc9, 0x48, 0xdb, 0x09, 0xe1, 0x93, 0x17, 0x7e, 0x0b, 0xad, 0xda,
-  0x67, 0x25, 0xfe, 0x5f, 0x8b, 0x73, 0xb7, 0xac, 0x6b, 0x9c, 0xb3, 0xb3,
-  0xb7, 0x36, 0x74, 0x90, 0x7c, 0x60, 0x96, 0xcf, 0x78, 0xe5, 0x1b, 0x68,
-  0x6e, 0x82, 0xe6, 0x6f, 0xc1, 0xf9, 0xd8, 0x50, 0x2f, 0x25, 0xba, 0xaa,
-  0xf1, 0xb5, 0x92, 0x67, 0x50, 0x7a, 0x50, 0xbb, 0xba, 0xe4, 0x3c, 0x7c,
-  0x2d, 0xe2, 0x67, 0xb9, 0x10, 0x48, 0xcf, 0x23, 0xf4, 0x73, 0x07, 0xfe,
-  0x99, 0x8c, 0x3d, 0xe4, 0x9b, 0x0d, 0x5e, 0xf2, 0x77, 0xa0, 0x5e, 0x53,
-  0xd9, 0x17, 0x02, 0xbf, 0x2b, 0x16, 0x65, 0x8d, 0x79, 0x9a, 0xba, 0x5f,
-  0x2a, 0xab, 0x80, 0x7a, 0xd0, 0x3c, 0x3f, 0xf0, 0x3d, 0x68, 0xd3, 0x5a,
-  0xdc, 0xcf, 0xb8, 0xf3, 0x27, 0xd6, 0xa6, 0x0e, 0x4b, 0x9c, 0xd1, 0xca,
-  0xe8, 0xd1, 0x20, 0x80, 0x16, 0xd0, 0xab, 0x81, 0x08, 0x08, 0x11, 0x2a,
-  0x9a, 0x58, 0x44, 0xf3, 0xc7, 0xc0, 0xcf, 0xd0, 0x41, 0x44, 0x11, 0x74,
-  0xa8, 0x9a, 0x58, 0x57, 0x1e, 0x49, 0x1d, 0xd6, 0xe4, 0x6f, 0x4b, 0xdc,
-  0x82, 0xb9, 0xfe, 0x33, 0x87, 0x41, 0x22, 0x75, 0xfb, 0x8e, 0x00, 0xd9,
-  0xaa, 0xec, 0xa0, 0xa3, 0xe5, 0x48, 0x63, 0x67, 0x03, 0x6f, 0xaa, 0x68,
-  0xfe, 0x82, 0x71, 0xf5, 0x0d, 0x35, 0x6a, 0xbc, 0xc9, 0xce, 0x25, 0x7e,
-  0x31, 0x3a, 0xdf, 0xb8, 0x26, 0xd0, 0x92, 0x98, 0x81, 0xfa, 0x29, 0xa4,
-  0x69, 0xb1, 0x23, 0x5f, 0x12, 0xe6, 0x1a, 0xd6, 0x67, 0x38, 0x4a, 0x87,
-  0x2e, 0xf2, 0x71, 0xf5, 0x8b, 0xd9, 0xf5, 0xd3, 0x1b, 0x3f, 0xda, 0x0c,
-  0xcc, 0xee, 0x5e, 0xbc, 0xe1, 0xd1, 0x7a, 0x4a, 0x6b, 0xf7, 0x7d, 0x01,
-  0x0f, 0xce, 0xe1, 0x5b, 0x92, 0x26, 0xb6, 0xd8, 0x31, 0xe8, 0xfb, 0x1f,
-  0xcb, 0x9f, 0xd5, 0xdc, 0x91, 0x05, 0x6f, 0xa9, 0x3f, 0x31, 0xef, 0xd4,
-  0x31, 0x38, 0x71, 0x02, 0x0d, 0x5f, 0x0a, 0xaf, 0x0d, 0x2e, 0x9a, 0x6e,
-  0x20, 0x01, 0xf8, 0x38, 0x09, 0x7f, 0x4e, 0x1a, 0x39, 0xcd, 0xe8, 0x8e,
-  0x30, 0x5e, 0x30, 0xa8, 0xb2, 0x60, 0x7e, 0xb4, 0x6a, 0xb8, 0xdc, 0x19,
-  0x68, 0xdf, 0x4c, 0x40, 0x56, 0xf1, 0x82, 0x9c, 0x9d, 0x6a, 0x67, 0x92,
-  0xc2, 0x0e, 0x38, 0xb8, 0x91, 0x02, 0x6f, 0xbf, 0xbc, 0xd2, 0x73, 0x23,
-  0x03, 0xcb, 0x71, 0x45, 0xcb, 0xd6, 0x7b, 0x0d, 0xbc, 0x95, 0x7e, 0xef,
-  0xed, 0xe5, 0x2b, 0x1e, 0x41, 0x5b, 0x77, 0x15, 0x3a, 0xa3, 0x79, 0x8e,
-  0xa5, 0xfe, 0xca, 0xc1, 0x1f, 0x3e, 0xfd, 0xf8, 0x40, 0x6b, 0xb1, 0xc7,
-  0x5b, 0xa4, 0xf8, 0x59, 0x88, 0xfb, 0x0d, 0xc7, 0x13, 0x22, 0x8e, 0x93,
-  0xef, 0xca, 0x37, 0xe0, 0xfc, 0x04, 0x8c, 0x19, 0xa8, 0x83, 0xd0, 0xc0,
-  0x47, 0xe4, 0x57, 0xd2, 0x63, 0x5a, 0xd6, 0x67, 0x42, 0x57, 0xb3, 0x15,
-  0x8d, 0xee, 0x6c, 0xf9, 0xf0, 0x16, 0xf8, 0x1b, 0xde, 0x7b, 0x1c, 0x0d,
-  0x3e, 0x3a, 0xd0, 0xfc, 0x76, 0x64, 0xdf, 0x37, 0xcf, 0x58, 0xeb, 0x29,
-  0xc4, 0xb6, 0xc4, 0xf8, 0x95, 0x79, 0xed, 0x2b, 0x8e, 0x10, 0x2b, 0xfd,
-  0x09, 0x79, 0xf1, 0x7e, 0x67, 0xbd, 0x10, 0xd1, 0xd0, 0x99, 0xe8, 0x8f,
-  0xb4, 0x31, 0x38, 0xf5, 0x3f, 0x3f, 0x1e, 0x86, 0x2c, 0x6d, 0xa2, 0x74,
-  0x93, 0x63, 0x6f, 0xf8, 0x11, 0x33, 0x81, 0x40, 0x63, 0xbd, 0xdb, 0xc5,
-  0x3b, 0xa8, 0xf2, 0x2e, 0xa3, 0xdc, 0x81, 0x6f, 0x31, 0x67, 0xda, 0xe9,
-  0x84, 0x24, 0xff, 0x3f, 0xd9, 0x1d, 0x33, 0x95, 0xe7, 0x35, 0x90, 0x4d,
-  0xe0, 0x91, 0xa0, 0x3e, 0xe5, 0xdb, 0x4a, 0x77, 0x6e, 0x9a, 0x15, 0x1e,
-  0x3b, 0x93, 0xb4, 0xb2, 0x0b, 0x6f, 0x38, 0x4a, 0x1d, 0xe8, 0x82, 0x97,
-  0xa2, 0x2d, 0xfe, 0x2b, 0xe7, 0x3b, 0xd9, 0xbe, 0x1b, 0x76, 0x7c, 0x52,
-  0xe2, 0x0b, 0x25, 0xf4, 0xf7, 0xb0, 0x92, 0x86, 0xd7, 0x62, 0x4b, 0x7a,
-  0x33, 0xf0, 0x67, 0x08, 0x8f, 0xe8, 0x26, 0xf8, 0x1c, 0xbc, 0x03, 0x4d,
-  0xeb, 0x6f, 0x9e, 0x7e, 0x7c, 0x60, 0xc6, 0x9f, 0xbb, 0xb8, 0x8b, 0x1c,
-  0xaf, 0x58, 0xe1, 0x97, 0xda, 0xfc, 0x1b, 0x8f, 0x27, 0x38, 0x1f, 0x27,
-  0xf7, 0x4c, 0x8c, 0xa1, 0x7c, 0x31, 0x20, 0x66, 0x40, 0xb9, 0x98, 0x02,
-  0x1e, 0xa5, 0x3f, 0xd5, 0x56, 0x3e, 0x70, 0x21, 0x26, 0x34, 0x97, 0xfc,
-  0xd2, 0x1d, 0xb2, 0x6f, 0xbf, 0x0b, 0x6c, 0x65, 0xaf, 0xa4, 0xb0, 0x6f,
-  0xda, 0x15, 0xab, 0x1d, 0xe7, 0x1c, 0x72, 0x5c, 0x28, 0x99, 0xbd, 0x58,
-  0xee, 0xc8, 0xd1, 0xbe, 0x2f, 0xc4, 0x5f, 0x49, 0xea, 0x29, 0x50, 0x0e,
-  0x0c, 0xf8, 0xdb, 0xd9, 0x82, 0xb7, 0x64, 0xbe, 0x53, 0xde, 0xfe, 0x38,
-  0x28, 0xb5, 0x54, 0x78, 0x04, 0x1a, 0x25, 0xfd, 0xcf, 0x7f, 0xd1, 0x19,
-  0x47, 0xb5, 0xa1, 0x5b, 0x8a, 0x0c, 0x09, 0xbc, 0xd4, 0x08, 0xfa, 0x82,
-  0x1c, 0x34, 0x68, 0xd6, 0x28, 0xb5, 0x11, 0x1f, 0x25, 0x76, 0x3c, 0xc3,
-  0x44, 0x62, 0x95, 0xf8, 0x5a, 0x9b, 0x1c, 0xc2, 0xe6, 0x15, 0x0b, 0x71,
-  0xc3, 0x97, 0xc9, 0xf6, 0x85, 0xec, 0xea, 0xcc, 0x3a, 0xda, 0x04, 0x4a,
-  0x9e, 0x28, 0xf5, 0x7f, 0x27, 0x6b, 0x12, 0x35, 0x3a, 0xd7, 0x7d, 0x6a,
-  0x7b, 0xf6, 0x5d, 0x91, 0x87, 0x14, 0xb5, 0xab, 0xed, 0xdf, 0xca, 0xbb,
-  0x92, 0xc4, 0xc9, 0xbd, 0x66, 0xbb, 0xbb, 0xa6, 0x01, 0x8d, 0x3e, 0x17,
-  0x95, 0x24, 0x0a, 0x9b, 0xbe, 0xe1, 0xfa, 0xe3, 0x85, 0xdf, 0x8b, 0x8f,
-  0xda, 0xc4, 0x36, 0xe9, 0xd1, 0x04, 0x0e, 0x86, 0x57, 0xf9, 0xaa, 0x88,
-  0xfc, 0xc1, 0x70, 0xdf, 0x56, 0x88, 0xc0, 0xd0, 0xa6, 0xaf, 0xb2, 0x49,
-  0xac, 0xe6, 0xcf, 0xdb, 0x1b, 0x3a, 0xbd, 0x7f, 0x4b, 0xd2, 0xd8, 0xe1,
-  0xd3, 0xf6, 0xbe, 0xc8, 0xe7, 0x4f, 0xe7, 0x57, 0x21, 0xfe, 0x4a, 0xb8,
-  0x03, 0xfa, 0x96, 0x47, 0x9a, 0xbb, 0x29, 0x4f, 0xf2, 0x72, 0xc3, 0x71,
-  0xfe, 0x74, 0x79, 0x78, 0x54, 0x8c, 0xdf, 0xc8, 0xd3, 0x08, 0xbe, 0x6b,
-  0x74, 0x53, 0xdc, 0xd8, 0x91, 0xc6, 0xf7, 0x9f, 0x53, 0xce, 0x04, 0x99,
-  0xb8, 0x25, 0x09, 0x45, 0x0b, 0x70, 0xcf, 0xa4, 0x18, 0xa5, 0x4d, 0x53,
-  0x84, 0x8d, 0x82, 0x06, 0x62, 0x90, 0x92, 0xa2, 0x50, 0xd1, 0xbc, 0xf8,
-  0x8a, 0xd1, 0xf3, 0xdf, 0x70, 0x79, 0xb3, 0xcf, 0x59, 0xaa, 0xc1, 0x9d,
-  0x31, 0x77, 0xf4, 0x8c, 0xe4, 0xfb, 0xb4, 0xb3, 0xdc, 0xe8, 0xea, 0xbd,
-  0xa5, 0x49, 0xa6, 0x08, 0x08, 0x9e, 0xdb, 0xb3, 0xad, 0xf8, 0xa5, 0x01,
-  0x4c, 0xbb, 0xa2, 0x18, 0xb5, 0x7d, 0x5d, 0x3b, 0x4f, 0xe8, 0xb9, 0x4c,
-  0x49, 0x62, 0x30, 0x3f, 0xb7, 0xc0, 0x3b, 0xf0, 0x91, 0x9c, 0xf5, 0x33,
-  0xb4, 0xe8, 0x91, 0xe4, 0x00, 0x9a, 0xe3, 0xb7, 0x5a, 0xfb, 0x45, 0xf4,
-  0x19, 0xf5, 0x71, 0x19, 0xef, 0xe4, 0x8b, 0x84, 0x47, 0x1b, 0x59, 0x68,
-  0x13, 0xf4, 0x2d, 0xb9, 0x90, 0x36, 0x6f, 0x8a, 0xce, 0x09, 0xa2, 0x2e,
-  0x4f, 0x5d, 0xe0, 0x1f, 0xc6, 0xf3, 0x93, 0xf6, 0x62, 0xf1, 0x3f, 0x41,
-  0x34, 0x7f, 0x14, 0xb4, 0x02, 0x7f, 0x95, 0xae, 0xa1, 0xd3, 0x94, 0xbb,
-  0x75, 0x5e, 0x76, 0x57, 0x12, 0x79, 0x37, 0x67, 0xa2, 0xeb, 0x90, 0x28,
-  0xbc, 0x4a, 0xdd, 0x94, 0x5c, 0x51, 0x41, 0x9f, 0xaf, 0x99, 0xbf, 0xe7,
-  0xe7, 0x84, 0x42, 0x20, 0x06, 0xac, 0x49, 0x2a, 0x85, 0xc1, 0xc2, 0xba,
-  0x5d, 0xcc, 0x72, 0xb7, 0x82, 0xc7, 0x91, 0x95, 0x69, 0xd0, 0xf0, 0x52,
-  0x6a, 0xcb, 0x57, 0x61, 0xb2, 0x39, 0x31, 0xc9, 0x2a, 0x12, 0x7a, 0xfc,
-  0xea, 0x3a, 0x2f, 0x64, 0x25, 0x7e, 0xb2, 0x2b, 0xc6, 0x35, 0x38, 0x0d,
-  0xe6, 0x4b, 0x77, 0xb4, 0x3f, 0x35, 0xd8, 0x44, 0xae, 0xde, 0x6b, 0x77,
-  0x2a, 0x38, 0x14, 0x66, 0xa1, 0x49, 0x68, 0x8d, 0xf4, 0x0d, 0x9d, 0xb7,
-  0x14, 0x78, 0xcb, 0xc4, 0x36, 0xd3, 0x4a, 0xf6, 0x86, 0xa6, 0x0b, 0xdf,
-  0x34, 0xdc, 0x3d, 0x5e, 0xa2, 0x2a, 0x7a, 0x94, 0xfe, 0x4d, 0xd3, 0x6c,
-  0x8d, 0x6c, 0xc8, 0x85, 0xde, 0xa9, 0xa3, 0xb8, 0x3c, 0xd5, 0xbb, 0xe9,
-  0xce, 0x5e, 0x7a, 0x1d, 0x64, 0x5b, 0x70, 0xd3, 0x37, 0x2a, 0x2e, 0x2d,
-  0x76, 0xfe, 0x47, 0xbd, 0x47, 0x73, 0xa7, 0xd7, 0xe9, 0xe6, 0x83, 0x88,
-  0x3f, 0xfd, 0xa2, 0xa5, 0x34, 0x96, 0x0a, 0x8b, 0x79, 0xe9, 0xfd, 0x50,
-  0x19, 0x1b, 0x3a, 0xda, 0xe6, 0xc5, 0xa3, 0xf3, 0x0b, 0x20, 0x2e, 0x7a,
-  0xe9, 0x7c, 0x84, 0xaf, 0xda, 0xa5, 0x07, 0xe2, 0xa3, 0x54, 0x86, 0x7c,
-  0xe3, 0xe3, 0x81, 0x9d, 0x4d, 0x1d, 0xf5, 0x0a, 0x92, 0x75, 0xe7, 0xcd,
-  0x81, 0x04, 0xc3, 0x34, 0x0f, 0xa5, 0x30, 0x35, 0xab, 0xa8, 0xae, 0x8a,
-  0xbf, 0xb3, 0x21, 0xa0, 0x79, 0x97, 0x74, 0x25, 0x75, 0xf4, 0xbb, 0x93,
-  0x5c, 0x79, 0x81, 0x63, 0x67, 0x21, 0x43, 0xad, 0xeb, 0xf8, 0x76, 0xce,
-  0x88, 0x80, 0x39, 0xa9, 0xcf, 0x7f, 0x3a, 0xe9, 0xff, 0x0e, 0x5b, 0xde,
-  0x91, 0x94, 0x85, 0xcc, 0xa3, 0x76, 0xd5, 0xa5, 0x28, 0x7a, 0xbe, 0x8e,
-  0xad, 0xd2, 0x26, 0x47, 0xef, 0x0f, 0x0f, 0xad, 0x64, 0xab, 0x8b, 0x1e,
-  0x6d, 0xfe, 0xe3, 0xac, 0x73, 0xd6, 0xa2, 0x67, 0x4b, 0xd1, 0x09, 0xc4,
-  0x4c, 0x4e, 0xa8, 0xcf, 0x47, 0x69, 0xb2, 0xe4, 0x91, 0x19, 0x7d, 0x5c,
-  0xf0, 0x57, 0x04, 0x55, 0x47, 0x27, 0x3c, 0x0b, 0xf8, 0x37, 0x7d, 0x45,
-  0x52, 0x20, 0x2b, 0xf4, 0x43, 0x23, 0x1e, 0xfa, 0x4f, 0x89, 0x7d, 0x03,
-  0x72, 0x1d, 0x47, 0xc8, 0x45, 0xbd, 0x00, 0x7e, 0xe8, 0xa3, 0x15, 0xbb,
-  0xea, 0xe6, 0xa7, 0xe5, 0xd9, 0x4d, 0x77, 0x47, 0x8e, 0x79, 0x21, 0xa6,
-  0x1f, 0xbf, 0x1c, 0x98, 0xc3, 0xd2, 0xbf, 0x4f, 0x9c, 0x1c, 0xdf, 0xe0,
-  0x41, 0x9c, 0x06, 0x0d, 0x7e, 0x96, 0x4e, 0xe2, 0xe2, 0xa8, 0x76, 0x9d,
-  0x89, 0x27, 0x47, 0xfc, 0x1f, 0xbc, 0x3b, 0x1c, 0x44, 0x48, 0xf0, 0xe3,
-  0x9a, 0xe0, 0xac, 0x12, 0x82, 0xfe, 0x8b, 0x51, 0xd7, 0x1f, 0x65, 0x11,
-  0x32, 0xc5, 0x2f, 0xe5, 0xff, 0xec, 0xb3, 0xe6, 0x1b, 0x2e, 0xad, 0xe6,
-  0x19, 0x8f, 0xfe, 0xa3, 0xe1, 0xfa, 0xbb, 0x94, 0xaf, 0x02, 0x5d, 0xdd,
-  0xa2, 0x9b, 0x52, 0xda, 0x1d, 0x03, 0x41, 0x08, 0x3c, 0xb0, 0x2d, 0x9d,
-  0x1d, 0xec, 0xf5, 0x24, 0x7f, 0x2c, 0x78, 0x59, 0xe0, 0x0f, 0xe1, 0x2f,
-  0xed, 0x08, 0x75, 0x9a, 0x37, 0xce, 0x3d, 0x9d, 0x7e, 0x26, 0xd4, 0x17,
-  0xaf, 0xfc, 0x61, 0xa8, 0x07, 0x91, 0x3b, 0xff, 0x40, 0xdf, 0xcf, 0x28,
-  0x7e, 0x90, 0x3f, 0xd9, 0xf4, 0x4d, 0x73, 0x27, 0x10, 0x27, 0x9a, 0x6f,
-  0x84, 0x7f, 0x33, 0xc7, 0x48, 0x50, 0xdf, 0x22, 0xf9, 0x49, 0x49, 0xf8,
-  0x2f, 0xce, 0x27, 0x0d, 0x39, 0xd0, 0x8e, 0x18, 0x11, 0xe6, 0xdf, 0x7a,
-  0x7f, 0x15, 0xe4, 0xdf, 0xac, 0xbe, 0x9f, 0xc1, 0x67, 0xb4, 0xff, 0xef,
-  0x62, 0x5f, 0x91, 0xc7, 0x0f, 0x35, 0xf8, 0xa5, 0xf0, 0x0e, 0x71, 0x91,
-  0x05, 0xf9, 0x5b, 0x7c, 0xb2, 0x14, 0xc7, 0x7f, 0x02, 0xfc, 0x83, 0x7a,
-  0x21, 0xe6, 0x8e, 0x7e, 0xf7, 0x4f, 0x9a, 0x23, 0x85, 0xed, 0xaa, 0xf3,
-  0x64, 0xbc, 0x38, 0x58, 0x64, 0x84, 0x08, 0xfe, 0x6c, 0xf4, 0x8c, 0x78,
-  0x79, 0xa7, 0x18, 0xd1, 0xf4, 0x27, 0x1b, 0xaa, 0x4f, 0xa5, 0x5f, 0xe1,
-  0x25, 0xdb, 0x46, 0xfb, 0xe3, 0x57, 0x48, 0xd2, 0xe2, 0xbd, 0xc5, 0x7f,
-  0xb4, 0xb5, 0x7f, 0xb1, 0xa2, 0x44, 0x16, 0xbe, 0x1a, 0xee, 0x93, 0x7a,
-  0xc4, 0x76, 0x4a, 0xeb, 0x9d, 0x55, 0xde, 0xfe, 0x04, 0xa5, 0xe7, 0x94,
-  0xbf, 0x8a, 0x08, 0xc0, 0xd7, 0xdf, 0xa3, 0x56, 0x47, 0xd1, 0x15, 0x58,
-  0x09, 0x3d, 0xa1, 0x0e, 0x4e, 0x29, 0xdf, 0x28, 0x7d, 0xb3, 0xe6, 0x0e,
-  0x52, 0xfa, 0xa5, 0x97, 0x6b, 0x2a, 0xe8, 0x9f, 0xed, 0xc6, 0x20, 0x09,
-  0x1d, 0xa0, 0xee, 0x2d, 0x77, 0x7e, 0x78, 0xf9, 0x9f, 0xa8, 0xe6, 0x54,
-  0x54, 0xbe, 0x34, 0x91, 0x2b, 0xed, 0x9e, 0xef, 0xae, 0x7c, 0x09, 0x39,
-  0xea, 0x0d, 0x5e, 0x2a, 0x0b, 0xe9, 0xdb, 0x2e, 0xfd, 0xc9, 0xc2, 0x7f,
-  0x2b, 0xfe, 0x55, 0xbc, 0x48, 0x48, 0x3f, 0xe4, 0xdf, 0x06, 0xf6, 0xc7,
-  0xc0, 0xee, 0xaa, 0xb0, 0x9d, 0x6d, 0x5a, 0xfd, 0x44, 0x2f, 0xf7, 0xd5,
-  0xe4, 0xc5, 0x5e, 0xcd, 0xb7, 0xe8, 0xe6, 0xde, 0xce, 0xbc, 0x1b, 0xb9,
-  0x3c, 0xfb, 0xc9, 0x57, 0x41, 0x68, 0x6a, 0xa4, 0x88, 0xda, 0x88, 0x82,
-  0x15, 0x08, 0x3d, 0x1e, 0x44, 0x00, 0x7e, 0x52, 0xd0, 0x67, 0xc5, 0xaf,
-  0xa1, 0x07, 0xd9, 0xea, 0xe5, 0x45, 0x0f, 0x39, 0xe1, 0xcf, 0x3a, 0xb2,
-  0x7d, 0x1e, 0x92, 0x85, 0xc7, 0x96, 0x38, 0x91, 0x3d, 0xee, 0x92, 0x01,
-  0x3b, 0xe8, 0xe6, 0x29, 0x39, 0x7b, 0xfa, 0x37, 0x0a, 0xb4, 0x77, 0x4f,
-  0xff, 0x69, 0xf2, 0x57, 0x5d, 0x90, 0xa2, 0x05, 0x5e, 0x36, 0xcc, 0x99,
-  0x66, 0x76, 0x78, 0x0d, 0x92, 0x07, 0xe9, 0x51, 0x7d, 0x11, 0x12, 0xa4,
-  0x07, 0x91, 0x2f, 0x0b, 0xbf, 0x36, 0xe9, 0x29, 0xdf, 0x28, 0x5f, 0xe5,
-  0x25, 0x03, 0xa9, 0x7c, 0x3d, 0xe2, 0xa9, 0x8b, 0x7c, 0x01, 0xfe, 0x7b,
-  0xeb, 0x5b, 0xb4, 0x7f, 0xf3, 0xf6, 0x85, 0x56, 0xfd, 0xdc, 0x21, 0x5f,
-  0xd8, 0xbf, 0x19, 0x60, 0xad, 0xf2, 0xf5, 0xd6, 0x1f, 0x77, 0xff, 0xe6,
-  0x21, 0x5f, 0xe7, 0x78, 0xa1, 0xcd, 0xb7, 0x39, 0xc0, 0xff, 0xa0, 0xfe,
-  0x8d, 0x05, 0x72, 0xf4, 0x88, 0xa7, 0xcd, 0x68, 0x27, 0xbb, 0x6a, 0x24,
-  0x8f, 0x7a, 0x73, 0x16, 0x87, 0x5d, 0xf3, 0x72, 0x05, 0x7e, 0xef, 0x5c,
-  0xde, 0x43, 0xe7, 0xbc, 0xf9, 0x7e, 0xa2, 0x7e, 0xe4, 0x00, 0x9f, 0xb5,
-  0x7c, 0xae, 0xee, 0x0d, 0xa8, 0x51, 0xc3, 0xd7, 0x78, 0xcb, 0xa6, 0x8c,
-  0xc1, 0x68, 0x18, 0x51, 0xb1, 0x7b, 0x7e, 0x6a, 0x1c, 0x94, 0xd9, 0xc1,
-  0x33, 0xef, 0xc3, 0x2f, 0x96, 0xd5, 0x05, 0xc8, 0xc3, 0x64, 0x8f, 0x0e,
-  0xe1, 0xa8, 0xf1, 0x5c, 0xfb, 0xaa, 0x51, 0xe3, 0x5b, 0xf2, 0xb8, 0xb2,
-  0xaf, 0x1a, 0x4f, 0xd4, 0xb1, 0xd2, 0xe1, 0x2f, 0x1f, 0x25, 0xf0, 0x1a,
-  0x35, 0x6a, 0x64, 0x0c, 0x76, 0xe5, 0xaf, 0x9e, 0x2d, 0x33, 0x4a, 0x46,
-  0x13, 0x95, 0xac, 0xcc, 0xfc, 0xa8, 0x84, 0xb1, 0xec, 0xab, 0x46, 0x8d,
-  0x1a, 0x35, 0x6a, 0xd4, 0xa8, 0x91, 0x70, 0xfc, 0x06, 0x3b, 0xf9, 0x54,
-  0x1e, 0xca, 0x67, 0x18, 0x26, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e,
-  0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int font_terminess_14_png_len = 2453;
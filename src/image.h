@@ -1,10 +1,10 @@
 #pragma once
 
-#include "font_small_8_png.h"
-#include "font_mnemonika_10_png.h"
-#include "font_terminess_14_png.h"
-#include "cursor_arrow_png.h"
-#include "bg_odv9_pixel_frame_png.h"
+#include "font_small_8_rgba.h"
+#include "font_mnemonika_10_rgba.h"
+#include "font_terminess_14_rgba.h"
+#include "cursor_arrow_rgba.h"
+#include "bg_odv9_pixel_frame_rgba.h"
 
 static struct { char *key; SDL_Surface *value; } *image_cache = NULL;
 
@@ -16,53 +16,33 @@ SDL_Surface *create_surface(int32_t w, int32_t h){
     0xFF000000,0x00FF0000,0x0000FF00,0x000000FF);
 }
 
-void cache_static_image(const unsigned char *static_img_data, unsigned int len, const char *fake_fn){
+// Static images are decoded at build time (see 'make assets'), so caching
+// one only wraps its pixel array in a surface. The surface never owns or
+// frees the pixels and must not be drawn into.
+void cache_static_image(uint32_t *pixels, int32_t w, int32_t h, const char *fake_fn){
   SDL_Surface *image = shget(image_cache, fake_fn);
   if(image == NULL){
-    int32_t w, h, of;
-    unsigned char *data = stbi_load_from_memory(static_img_data, len, &w, &h, &of, 4);
-    SDL_Surface *tmp = SDL_CreateRGBSurfaceFrom((void*)data, w, h, 32, 4*w,0x000000FF,0x0000FF00,0x00FF0000,0xFF000000);
-    image = SDL_ConvertSurfaceFormat(tmp, SDL_PIXELFORMAT_RGBA8888, 0);
-    SDL_FreeSurface(tmp);
+    image = SDL_CreateRGBSurfaceFrom((void*)pixels, w, h, 32, 4*w, 0xFF000000,0x00FF0000,0x0000FF00,0x000000FF);
     shput(image_cache, fake_fn, image);
   }
 }
 
 void ready_static_images(void){
-  cache_static_image(cursor_arrow_png,         cursor_arrow_png_len,         "cursor-arrow.png");
-  cache_static_image(font_small_8_png,         font_small_8_png_len,         "font-small-8.png");
-  cache_static_image(font_mnemonika_10_png,    font_mnemonika_10_png_len,    "font-mnemonika-10.png");
-  cache_static_image(font_terminess_14_png,    font_terminess_14_png_len,    "font-terminess-14.png");
-  cache_static_image(bg_odv9_pixel_frame_png,  bg_odv9_pixel_frame_png_len,  "bg-odv9-pixel-frame.png");
+  cache_static_image(cursor_arrow_rgba,        cursor_arrow_rgba_w,        cursor_arrow_rgba_h,        "cursor-arrow.png");
+  cache_static_image(font_small_8_rgba,        font_small_8_rgba_w,        font_small_8_rgba_h,        "font-small-8.png");
+  cache_static_image(font_mnemonika_10_rgba,   font_mnemonika_10_rgba_w,   font_mnemonika_10_rgba_h,   "font-mnemonika-10.png");
+  cache_static_image(font_terminess_14_rgba,   font_terminess_14_rgba_w,   font_terminess_14_rgba_h,   "font-terminess-14.png");
+  cache_static_image(bg_odv9_pixel_frame_rgba, bg_odv9_pixel_frame_rgba_w, bg_odv9_pixel_frame_rgba_h, "bg-odv9-pixel-frame.png");
 }
 
+// Images other than the static ones are decoded off the main thread; see
+// loader.h. Until then they are not in the cache and this returns NULL.
 SDL_Surface *get_image(const char *fn){
   SDL_Surface *image = shget(image_cache, fn);
 
   if(image == NULL && strlen(fn) > 0){
-    printf("WARNING: Loading non-static image: %s \n", fn);
+    printf("WARNING: Image not loaded: %s \n", fn);
   }
-  
-  /*
-  if(image == NULL){
-    int32_t w, h, of;
-
-    unsigned char *data = stbi_load(fn, &w, &h, &of, 4);
-
-    if(data == NULL){
-        printf("ERROR: Image failed to load: %s\n", fn); fflush(stdout);
-        return NULL;
-    }
-
-    SDL_Surface *tmp = SDL_CreateRGBSurfaceFrom((void*)data, w, h, 32, 4*w,0x000000FF,0x0000FF00,0x00FF0000,0xFF000000);
-    image = SDL_ConvertSurfaceFormat(tmp, SDL_PIXELFORMAT_RGBA8888, 0);
-    SDL_FreeSurface(tmp);
-    stbi_image_free(data);
-
-    shput(image_cache, fn, image);
-  } */
 
   return image;
 }
-
-
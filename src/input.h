@@ -13,27 +13,34 @@ bool controller_just_pressed(uint32_t buttons);
 bool controller_just_released(uint32_t buttons);
 void controller_read(void);
 
-static controller_t CN;
+bool controller_record(const char *fn);
+bool controller_replay(const char *fn);
+bool controller_replay_done(void);
+void controller_finish(void);
+bool controller_config(const char *fn);
 
-static uint32_t KEYMAP_L =     SDL_SCANCODE_LEFT;
-static uint32_t KEYMAP_R =     SDL_SCANCODE_RIGHT;
-static uint32_t KEYMAP_U =     SDL_SCANCODE_UP;
-static uint32_t KEYMAP_D =     SDL_SCANCODE_DOWN;
+static controller_t CN;
 
-static uint32_t KEYMAP_A =     SDL_SCANCODE_Z;
-static uint32_t KEYMAP_B =     SDL_SCANCODE_X;
-static uint32_t KEYMAP_X =     SDL_SCANCODE_C;
-static uint32_t KEYMAP_Y =     SDL_SCANCODE_V;
+// A recording is the CN.pressed word of every tick the game ran, stored as
+// runs of (pressed, ticks) after a two-word header. Feeding the same words
+// back tick for tick replays the session exactly, however fast it runs.
+#define INPUT_LOG_MAGIC   0x31474C49 // "ILG1" read as a little-endian word
+#define INPUT_LOG_VERSION 1
 
-static uint32_t KEYMAP_LB =    SDL_SCANCODE_F1;
-static uint32_t KEYMAP_RB =    SDL_SCANCODE_F2;
-static uint32_t KEYMAP_LT =    SDL_SCANCODE_1;
-static uint32_t KEYMAP_RT =    SDL_SCANCODE_2;
+typedef struct {
+  uint32_t pressed; // buttons held
+  uint32_t ticks;   // for this many ticks in a row
+} input_run_t;
 
-static uint32_t KEYMAP_LS =    SDL_SCANCODE_F3;
-static uint32_t KEYMAP_RS =    SDL_SCANCODE_F4;
-static uint32_t KEYMAP_BACK =  SDL_SCANCODE_BACKSPACE;
-static uint32_t KEYMAP_START = SDL_SCANCODE_RETURN;
+static struct {
+  FILE *record_fp;       // open while recording
+  input_run_t run;       // run being recorded, written once the buttons change
+  input_run_t *replay;   // every run of the recording being replayed
+  size_t replay_count;
+  size_t replay_at;      // run being replayed
+  uint32_t replay_ticks; // ticks of it already fed in
+  bool replaying;
+} INPUT_LOG;
 
 const uint32_t BTN_L =       0x00000001;
 const uint32_t BTN_R =       0x00000002;
@@ -54,7 +61,65 @@ const uint32_t BTN_BACK =    0x00004000;
 const uint32_t BTN_START =   0x00008000;
 const uint32_t BTN_NONE =    0x00000000;
 
-void controller_init(void){  CN.pressed = BTN_NONE; CN.previous = BTN_NONE; SDL_JoystickOpen(0); }
+// Names of the buttons in the bindings file, by bit: BTN_L is 1 << 0.
+static const char *BTN_NAMES[16] = { "L", "R", "U", "D", "A", "B", "X", "Y", "LB", "RB", "LT", "RT", "LS", "RS", "BACK", "START" };
+
+// Bindings. Each table maps what an event reports straight to the buttons it
+// presses, so an event costs one load however many bindings there are.
+#define JOY_BUTTONS     32    // buttons of a plain joystick that can be bound
+#define PAD_TRIGGER_ON  16384 // a trigger presses past here...
+#define PAD_TRIGGER_OFF 8192  // ...and lets go below here
+
+static uint32_t KEY_BUTTON[SDL_NUM_SCANCODES];
+static uint32_t JOY_BUTTON[JOY_BUTTONS];                 // joysticks SDL has no mapping for
+static uint32_t PAD_BUTTON[SDL_CONTROLLER_BUTTON_MAX];   // game controllers, by their standard layout
+static uint32_t PAD_AXIS[SDL_CONTROLLER_AXIS_MAX];       // only the triggers are bound
+static uint32_t HAT_BUTTON[16];                          // by SDL_HAT_* bits
+
+static void controller_bind_defaults(void){
+  memset(KEY_BUTTON, 0, sizeof(KEY_BUTTON));
+  KEY_BUTTON[SDL_SCANCODE_LEFT] = BTN_L;   KEY_BUTTON[SDL_SCANCODE_RIGHT] = BTN_R;
+  KEY_BUTTON[SDL_SCANCODE_UP] = BTN_U;     KEY_BUTTON[SDL_SCANCODE_DOWN] = BTN_D;
+  KEY_BUTTON[SDL_SCANCODE_Z] = BTN_A;      KEY_BUTTON[SDL_SCANCODE_X] = BTN_B;
+  KEY_BUTTON[SDL_SCANCODE_C] = BTN_X;      KEY_BUTTON[SDL_SCANCODE_V] = BTN_Y;
+  KEY_BUTTON[SDL_SCANCODE_F1] = BTN_LB;    KEY_BUTTON[SDL_SCANCODE_F2] = BTN_RB;
+  KEY_BUTTON[SDL_SCANCODE_1] = BTN_LT;     KEY_BUTTON[SDL_SCANCODE_2] = BTN_RT;
+  KEY_BUTTON[SDL_SCANCODE_F3] = BTN_LS;    KEY_BUTTON[SDL_SCANCODE_F4] = BTN_RS;
+  KEY_BUTTON[SDL_SCANCODE_BACKSPACE] = BTN_BACK; KEY_BUTTON[SDL_SCANCODE_RETURN] = BTN_START;
+
+  memset(JOY_BUTTON, 0, sizeof(JOY_BUTTON));
+  JOY_BUTTON[0] = BTN_A;  JOY_BUTTON[1] = BTN_B;  JOY_BUTTON[2] = BTN_X;    JOY_BUTTON[3] = BTN_Y;
+  JOY_BUTTON[4] = BTN_LB; JOY_BUTTON[5] = BTN_RB; JOY_BUTTON[6] = BTN_BACK; JOY_BUTTON[7] = BTN_START;
+
+  memset(PAD_BUTTON, 0, sizeof(PAD_BUTTON));
+  PAD_BUTTON[SDL_CONTROLLER_BUTTON_A] = BTN_A;    PAD_BUTTON[SDL_CONTROLLER_BUTTON_B] = BTN_B;
+  PAD_BUTTON[SDL_CONTROLLER_BUTTON_X] = BTN_X;    PAD_BUTTON[SDL_CONTROLLER_BUTTON_Y] = BTN_Y;
+  PAD_BUTTON[SDL_CONTROLLER_BUTTON_LEFTSHOULDER] = BTN_LB; PAD_BUTTON[SDL_CONTROLLER_BUTTON_RIGHTSHOULDER] = BTN_RB;
+  PAD_BUTTON[SDL_CONTROLLER_BUTTON_LEFTSTICK] = BTN_LS;    PAD_BUTTON[SDL_CONTROLLER_BUTTON_RIGHTSTICK] = BTN_RS;
+  PAD_BUTTON[SDL_CONTROLLER_BUTTON_BACK] = BTN_BACK;       PAD_BUTTON[SDL_CONTROLLER_BUTTON_START] = BTN_START;
+  PAD_BUTTON[SDL_CONTROLLER_BUTTON_DPAD_UP] = BTN_U;       PAD_BUTTON[SDL_CONTROLLER_BUTTON_DPAD_DOWN] = BTN_D;
+  PAD_BUTTON[SDL_CONTROLLER_BUTTON_DPAD_LEFT] = BTN_L;     PAD_BUTTON[SDL_CONTROLLER_BUTTON_DPAD_RIGHT] = BTN_R;
+
+  memset(PAD_AXIS, 0, sizeof(PAD_AXIS));
+  PAD_AXIS[SDL_CONTROLLER_AXIS_TRIGGERLEFT] = BTN_LT; PAD_AXIS[SDL_CONTROLLER_AXIS_TRIGGERRIGHT] = BTN_RT;
+
+  for(int v=0; v<16; v++){
+    HAT_BUTTON[v] = ((v & SDL_HAT_UP) ? BTN_U : 0) | ((v & SDL_HAT_RIGHT) ? BTN_R : 0) |
+                    ((v & SDL_HAT_DOWN) ? BTN_D : 0) | ((v & SDL_HAT_LEFT) ? BTN_L : 0);
+  }
+}
+
+// Whether a joystick is one SDL drives as a game controller, whose raw
+// events would otherwise press buttons twice.
+static bool controller_is_pad(SDL_JoystickID id){ return SDL_GameControllerFromInstanceID(id) != NULL; }
+
+// Devices are opened as SDL announces them, which it also does for those
+// already plugged in at startup.
+void controller_init(void){
+  CN.pressed = BTN_NONE; CN.previous = BTN_NONE;
+  controller_bind_defaults();
+  SDL_GameControllerAddMappingsFromFile("gamecontrollerdb.txt"); // Extra mappings, if there are any
+}
 void controller_reset(void){ CN.pressed = BTN_NONE; CN.previous = BTN_NONE; }
 bool controller_pressed(uint32_t buttons){ return ((CN.pressed & buttons) == buttons); }
 bool controller_released(uint32_t buttons){  return !((CN.pressed & buttons) == buttons); }
@@ -66,71 +131,162 @@ void controller_read(void){
 
   CN.previous = CN.pressed;
   while(SDL_PollEvent(&e)){
-    if(e.type == SDL_KEYDOWN){
-      uint32_t key = e.key.keysym.scancode;
-            if(key == KEYMAP_U){  CN.pressed |= BTN_U;
-      }else if(key == KEYMAP_D){  CN.pressed |= BTN_D;
-      }else if(key == KEYMAP_L){  CN.pressed |= BTN_L;
-      }else if(key == KEYMAP_R){  CN.pressed |= BTN_R;
-      }else if(key == KEYMAP_A){  CN.pressed |= BTN_A;
-      }else if(key == KEYMAP_B){  CN.pressed |= BTN_B;
-      }else if(key == KEYMAP_X){  CN.pressed |= BTN_X;
-      }else if(key == KEYMAP_Y){  CN.pressed |= BTN_Y;
-      }else if(key == KEYMAP_LB){ CN.pressed |= BTN_LB;
-      }else if(key == KEYMAP_RB){ CN.pressed |= BTN_RB;
-      }else if(key == KEYMAP_LT){ CN.pressed |= BTN_LT;
-      }else if(key == KEYMAP_RT){ CN.pressed |= BTN_RT;
-      }else if(key == KEYMAP_LS){ CN.pressed |= BTN_LS;
-      }else if(key == KEYMAP_RS){ CN.pressed |= BTN_RS;
-      }else if(key == KEYMAP_START){ CN.pressed |= BTN_START;
-      }else if(key == KEYMAP_BACK){  CN.pressed |= BTN_BACK; }
-    }else if(e.type == SDL_KEYUP){
-      uint32_t key = e.key.keysym.scancode;
-            if(key == KEYMAP_U){ CN.pressed &= ~BTN_U;
-      }else if(key == KEYMAP_D){ CN.pressed &= ~BTN_D;
-      }else if(key == KEYMAP_L){ CN.pressed &= ~BTN_L;
-      }else if(key == KEYMAP_R){ CN.pressed &= ~BTN_R;
-      }else if(key == KEYMAP_A){ CN.pressed &= ~BTN_A;
-      }else if(key == KEYMAP_B){ CN.pressed &= ~BTN_B;
-      }else if(key == KEYMAP_X){ CN.pressed &= ~BTN_X;
-      }else if(key == KEYMAP_Y){ CN.pressed &= ~BTN_Y;
-      }else if(key == KEYMAP_LB){ CN.pressed &= ~BTN_LB;
-      }else if(key == KEYMAP_RB){ CN.pressed &= ~BTN_RB;
-      }else if(key == KEYMAP_LT){ CN.pressed &= ~BTN_LT;
-      }else if(key == KEYMAP_RT){ CN.pressed &= ~BTN_RT;
-      }else if(key == KEYMAP_LS){ CN.pressed &= ~BTN_LS;
-      }else if(key == KEYMAP_RS){ CN.pressed &= ~BTN_RS;
-      }else if(key == KEYMAP_START){ CN.pressed &= ~BTN_START;
-      }else if(key == KEYMAP_BACK){ CN.pressed &= ~BTN_BACK; }
-    }else if(e.type == SDL_JOYHATMOTION){
-      CN.pressed &= ~BTN_DIR_ANY;
-      if(e.jhat.value == SDL_HAT_UP){ CN.pressed |= BTN_U;
-      }else if(e.jhat.value == SDL_HAT_LEFT){      CN.pressed |= BTN_L;
-      }else if(e.jhat.value == SDL_HAT_RIGHT){     CN.pressed |= BTN_R;
-      }else if(e.jhat.value == SDL_HAT_DOWN){      CN.pressed |= BTN_D;
-      }else if(e.jhat.value == SDL_HAT_LEFTUP){    CN.pressed |= BTN_L | BTN_U;
-      }else if(e.jhat.value == SDL_HAT_RIGHTUP){   CN.pressed |= BTN_R | BTN_U;
-      }else if(e.jhat.value == SDL_HAT_LEFTDOWN){  CN.pressed |= BTN_L | BTN_D;
-      }else if(e.jhat.value == SDL_HAT_RIGHTDOWN){ CN.pressed |= BTN_R | BTN_D; }
-    }else if(e.type == SDL_JOYBUTTONDOWN){
-            if(e.jbutton.button == 0){ CN.pressed |= BTN_A;
-      }else if(e.jbutton.button == 1){ CN.pressed |= BTN_B;
-      }else if(e.jbutton.button == 2){ CN.pressed |= BTN_X;
-      }else if(e.jbutton.button == 3){ CN.pressed |= BTN_Y;
-      }else if(e.jbutton.button == 4){ CN.pressed |= BTN_LB;
-      }else if(e.jbutton.button == 5){ CN.pressed |= BTN_RB;
-      }else if(e.jbutton.button == 6){ CN.pressed |= BTN_BACK;
-      }else if(e.jbutton.button == 7){ CN.pressed |= BTN_START; }
-    }else if(e.type == SDL_JOYBUTTONUP){
-            if(e.jbutton.button == 0){ CN.pressed &= ~BTN_A;
-      }else if(e.jbutton.button == 1){ CN.pressed &= ~BTN_B;
-      }else if(e.jbutton.button == 2){ CN.pressed &= ~BTN_X;
-      }else if(e.jbutton.button == 3){ CN.pressed &= ~BTN_Y;
-      }else if(e.jbutton.button == 4){ CN.pressed &= ~BTN_LB;
-      }else if(e.jbutton.button == 5){ CN.pressed &= ~BTN_RB;
-      }else if(e.jbutton.button == 6){ CN.pressed &= ~BTN_BACK;
-      }else if(e.jbutton.button == 7){ CN.pressed &= ~BTN_START; }
+    if(INPUT_LOG.replaying){ continue; } // Still drained, so window events reach the event watch.
+    switch(e.type){
+      case SDL_KEYDOWN: CN.pressed |= KEY_BUTTON[e.key.keysym.scancode]; break;
+      case SDL_KEYUP:   CN.pressed &= ~KEY_BUTTON[e.key.keysym.scancode]; break;
+
+      case SDL_CONTROLLERBUTTONDOWN: if(e.cbutton.button < SDL_CONTROLLER_BUTTON_MAX){ CN.pressed |= PAD_BUTTON[e.cbutton.button]; } break;
+      case SDL_CONTROLLERBUTTONUP:   if(e.cbutton.button < SDL_CONTROLLER_BUTTON_MAX){ CN.pressed &= ~PAD_BUTTON[e.cbutton.button]; } break;
+      case SDL_CONTROLLERAXISMOTION:
+        if(e.caxis.axis >= SDL_CONTROLLER_AXIS_MAX){ break; }
+        if(e.caxis.value > PAD_TRIGGER_ON){ CN.pressed |= PAD_AXIS[e.caxis.axis]; }
+        else if(e.caxis.value < PAD_TRIGGER_OFF){ CN.pressed &= ~PAD_AXIS[e.caxis.axis]; }
+        break;
+
+      case SDL_JOYBUTTONDOWN: if(e.jbutton.button < JOY_BUTTONS && !controller_is_pad(e.jbutton.which)){ CN.pressed |= JOY_BUTTON[e.jbutton.button]; } break;
+      case SDL_JOYBUTTONUP:   if(e.jbutton.button < JOY_BUTTONS && !controller_is_pad(e.jbutton.which)){ CN.pressed &= ~JOY_BUTTON[e.jbutton.button]; } break;
+      case SDL_JOYHATMOTION:
+        if(!controller_is_pad(e.jhat.which)){ CN.pressed = (CN.pressed & ~BTN_DIR_ANY) | HAT_BUTTON[e.jhat.value & 0xF]; }
+        break;
+
+      // Anything SDL has a mapping for is a game controller; any other joystick is read raw.
+      case SDL_CONTROLLERDEVICEADDED: SDL_GameControllerOpen(e.cdevice.which); break;
+      case SDL_JOYDEVICEADDED: if(!SDL_IsGameController(e.jdevice.which)){ SDL_JoystickOpen(e.jdevice.which); } break;
+      // Whatever it was holding would never be let go.
+      case SDL_CONTROLLERDEVICEREMOVED: SDL_GameControllerClose(SDL_GameControllerFromInstanceID(e.cdevice.which)); CN.pressed = BTN_NONE; break;
+      case SDL_JOYDEVICEREMOVED:
+        if(!controller_is_pad(e.jdevice.which)){ SDL_JoystickClose(SDL_JoystickFromInstanceID(e.jdevice.which)); CN.pressed = BTN_NONE; }
+        break;
     }
   }
+  if(INPUT_LOG.replaying){
+    while(INPUT_LOG.replay_at < INPUT_LOG.replay_count &&
+          INPUT_LOG.replay_ticks == INPUT_LOG.replay[INPUT_LOG.replay_at].ticks){
+      INPUT_LOG.replay_at += 1;
+      INPUT_LOG.replay_ticks = 0;
+    }
+    if(controller_replay_done()){ CN.pressed = BTN_NONE; return; }
+    CN.pressed = INPUT_LOG.replay[INPUT_LOG.replay_at].pressed;
+    INPUT_LOG.replay_ticks += 1;
+  }
+
+  if(INPUT_LOG.record_fp != NULL){
+    if(INPUT_LOG.run.ticks > 0 && INPUT_LOG.run.pressed != CN.pressed){
+      fwrite(&INPUT_LOG.run, sizeof(input_run_t), 1, INPUT_LOG.record_fp);
+      fflush(INPUT_LOG.record_fp);
+      INPUT_LOG.run.ticks = 0;
+    }
+    INPUT_LOG.run.pressed = CN.pressed;
+    INPUT_LOG.run.ticks += 1;
+  }
+}
+
+////////////////////////// RECORD / REPLAY //////////////////////////
+
+// Starts logging the buttons of every tick to fn.
+bool controller_record(const char *fn){
+  INPUT_LOG.record_fp = fopen(fn, "wb");
+  if(INPUT_LOG.record_fp == NULL){
+    fprintf(stderr, "ERROR: controller_record: Cannot write %s\n", fn);
+    return false;
+  }
+  uint32_t header[2] = { INPUT_LOG_MAGIC, INPUT_LOG_VERSION };
+  fwrite(header, sizeof(header), 1, INPUT_LOG.record_fp);
+  INPUT_LOG.run = (input_run_t){ BTN_NONE, 0 };
+  return true;
+}
+
+// Loads a recording whole, then feeds it in place of the real controls.
+bool controller_replay(const char *fn){
+  FILE *fp = fopen(fn, "rb");
+  if(fp == NULL){ fprintf(stderr, "ERROR: controller_replay: Cannot open %s\n", fn); return false; }
+  uint32_t header[2];
+  if(fread(header, sizeof(header), 1, fp) != 1 || header[0] != INPUT_LOG_MAGIC || header[1] != INPUT_LOG_VERSION){
+    fprintf(stderr, "ERROR: controller_replay: %s is not an input recording.\n", fn);
+    fclose(fp);
+    return false;
+  }
+  input_run_t run;
+  while(fread(&run, sizeof(input_run_t), 1, fp) == 1){
+    INPUT_LOG.replay = realloc(INPUT_LOG.replay, (INPUT_LOG.replay_count+1)*sizeof(input_run_t));
+    INPUT_LOG.replay[INPUT_LOG.replay_count++] = run;
+  }
+  fclose(fp);
+  INPUT_LOG.replay_at = 0;
+  INPUT_LOG.replay_ticks = 0;
+  INPUT_LOG.replaying = true;
+  return true;
 }
 
+bool controller_replay_done(void){
+  return INPUT_LOG.replaying && INPUT_LOG.replay_at >= INPUT_LOG.replay_count;
+}
+
+// Writes out the last run of a recording and closes it.
+void controller_finish(void){
+  if(INPUT_LOG.record_fp == NULL){ return; }
+  if(INPUT_LOG.run.ticks > 0){ fwrite(&INPUT_LOG.run, sizeof(input_run_t), 1, INPUT_LOG.record_fp); }
+  fclose(INPUT_LOG.record_fp);
+  INPUT_LOG.record_fp = NULL;
+}
+
+////////////////////////// BINDINGS //////////////////////////
+
+// Reads bindings from fn, one to a line, as a button name and what presses it:
+//
+//   START key Return      # a key, by its SDL scancode name
+//   A     joy 0           # a button of a joystick SDL has no mapping for
+//   B     pad b           # a game controller button, by its SDL name
+//   LT    pad lefttrigger # or one of its triggers
+//
+// The first binding of a kind replaces the defaults of that kind, so a file
+// that only binds keys leaves the controllers as they were. A missing file
+// keeps every default.
+bool controller_config(const char *fn){
+  FILE *fp = fopen(fn, "r");
+  if(fp == NULL){ return false; }
+  bool key_set = false, joy_set = false, pad_set = false;
+  char line[256];
+  for(int n=1; fgets(line, sizeof(line), fp) != NULL; n++){
+    char *hash = strchr(line, '#');
+    if(hash != NULL){ *hash = '\0'; }
+    size_t len = strlen(line);
+    while(len > 0 && isspace((unsigned char)line[len-1])){ line[--len] = '\0'; }
+
+    char name[16], kind[8];
+    int at = 0;
+    int got = sscanf(line, "%15s %7s %n", name, kind, &at);
+    if(got <= 0){ continue; } // Blank
+    const char *what = line + at;
+    uint32_t button = BTN_NONE;
+    for(int i=0; i<16; i++){ if(strcmp(name, BTN_NAMES[i]) == 0){ button = 1u << i; } }
+    if(button == BTN_NONE){ printf("WARNING: %s:%d: No button called %s\n", fn, n, name); continue; }
+    if(got < 2 || *what == '\0'){ printf("WARNING: %s:%d: Nothing bound to %s\n", fn, n, name); continue; }
+
+    if(strcmp(kind, "key") == 0){
+      SDL_Scancode sc = SDL_GetScancodeFromName(what);
+      if(sc == SDL_SCANCODE_UNKNOWN){ printf("WARNING: %s:%d: No key called %s\n", fn, n, what); continue; }
+      if(!key_set){ memset(KEY_BUTTON, 0, sizeof(KEY_BUTTON)); key_set = true; }
+      KEY_BUTTON[sc] |= button;
+    }else if(strcmp(kind, "joy") == 0){
+      char *end;
+      unsigned long b = strtoul(what, &end, 10);
+      if(end == what || *end != '\0' || b >= JOY_BUTTONS){ printf("WARNING: %s:%d: No joystick button %s\n", fn, n, what); continue; }
+      if(!joy_set){ memset(JOY_BUTTON, 0, sizeof(JOY_BUTTON)); joy_set = true; }
+      JOY_BUTTON[b] |= button;
+    }else if(strcmp(kind, "pad") == 0){
+      SDL_GameControllerButton b = SDL_GameControllerGetButtonFromString(what);
+      SDL_GameControllerAxis axis = SDL_GameControllerGetAxisFromString(what);
+      bool trigger = axis == SDL_CONTROLLER_AXIS_TRIGGERLEFT || axis == SDL_CONTROLLER_AXIS_TRIGGERRIGHT;
+      if(b == SDL_CONTROLLER_BUTTON_INVALID && !trigger){ printf("WARNING: %s:%d: No controller button %s\n", fn, n, what); continue; }
+      if(!pad_set){ memset(PAD_BUTTON, 0, sizeof(PAD_BUTTON)); memset(PAD_AXIS, 0, sizeof(PAD_AXIS)); pad_set = true; }
+      if(trigger){ PAD_AXIS[axis] |= button; }
+      else{ PAD_BUTTON[b] |= button; }
+    }else{
+      printf("WARNING: %s:%d: %s is not key, joy or pad\n", fn, n, kind);
+    }
+  }
+  fclose(fp);
+  return true;
+}
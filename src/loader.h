@@ -0,0 +1,197 @@
+#pragma once
+
+// Streams images that are not built in (see image.h) from disk. A worker
+// thread decodes them one at a time, newest request first, and hands the
+// surfaces back; the main thread files them in image_cache when it
+// collects them, so the cache is only ever touched from the main thread. An
+// SDL event is pushed for every image done, which wakes an idle main loop.
+// Streamed images stay cached only while loader_keep() is told they are
+// wanted, which keeps the cache to a scene and its neighbors.
+
+typedef struct {
+  char *fn;
+  SDL_Surface *image; // NULL if the file could not be decoded
+} loaded_image_t;
+
+static struct {
+  SDL_Thread *thread;
+  SDL_mutex *lock;
+  SDL_cond *wake;
+  char **queue;          // names waiting to be decoded, next last
+  loaded_image_t *done;  // decoded and waiting to be collected
+  bool quit;
+  bool sync;             // decode on request, on the calling thread
+  uint32_t event;        // type of the event pushed for each image done
+} LOADER;
+
+#define LOADER_NONE   0
+#define LOADER_QUEUED 1
+#define LOADER_FAILED 2
+#define LOADER_CACHED 3
+
+// Main thread only: how far along each requested image is. Its key is the
+// name the image is cached under, so the two share one allocation.
+static struct { char *key; int value; } *loader_state = NULL;
+
+static SDL_Surface *loader_decode(const char *fn){
+  int32_t w, h, of;
+  unsigned char *data = stbi_load(fn, &w, &h, &of, 4);
+  if(data == NULL){ return NULL; }
+  SDL_Surface *image = create_surface(w, h);
+  for(int32_t y=0; y<h; y++){
+    uint32_t *row = surface_row(image, y);
+    const unsigned char *px = data + (size_t)y*w*4;
+    for(int32_t x=0; x<w; x++, px+=4){
+      row[x] = ((uint32_t)px[0] << 24) | ((uint32_t)px[1] << 16) | ((uint32_t)px[2] << 8) | px[3];
+    }
+  }
+  stbi_image_free(data);
+  return image;
+}
+
+static int loader_main(void *data){
+  (void)(data); // Suppress unused warning
+  SDL_LockMutex(LOADER.lock);
+  while(true){
+    while(!LOADER.quit && arrlen(LOADER.queue) == 0){ SDL_CondWait(LOADER.wake, LOADER.lock); }
+    if(LOADER.quit){ break; }
+    char *fn = arrpop(LOADER.queue);
+    SDL_UnlockMutex(LOADER.lock);
+
+    loaded_image_t loaded = { fn, loader_decode(fn) };
+
+    SDL_LockMutex(LOADER.lock);
+    arrput(LOADER.done, loaded);
+    SDL_Event e;
+    memset(&e, 0, sizeof(e));
+    e.type = LOADER.event;
+    SDL_PushEvent(&e);
+  }
+  SDL_UnlockMutex(LOADER.lock);
+  return 0;
+}
+
+static bool loader_start(void){
+  if(LOADER.thread != NULL){ return true; }
+  LOADER.lock = SDL_CreateMutex();
+  LOADER.wake = SDL_CreateCond();
+  LOADER.event = SDL_RegisterEvents(1);
+  LOADER.thread = SDL_CreateThread(loader_main, "loader", NULL);
+  if(LOADER.thread == NULL){
+    fprintf(stderr, "ERROR: loader_start: %s\n", SDL_GetError());
+    return false;
+  }
+  return true;
+}
+
+// Makes every request decode its image before returning, so when an image
+// arrives depends only on when it was asked for, not on thread timing.
+void loader_set_sync(bool sync){
+  LOADER.sync = sync;
+}
+
+// Asks for fn to be decoded, unless it is cached or known bad. An urgent
+// request, for an image wanted on screen now, moves it to the front of the
+// queue even if it was already waiting there.
+void loader_request(const char *fn, bool urgent){
+  if(fn == NULL || fn[0] == '\0' || shget(image_cache, fn) != NULL){ return; }
+  int state = shget(loader_state, fn);
+  if(state == LOADER_FAILED || (state == LOADER_QUEUED && !urgent)){ return; }
+  if(LOADER.sync){
+    char *key = malloc(strlen(fn) + 1);
+    strcpy(key, fn);
+    SDL_Surface *image = loader_decode(key);
+    if(image == NULL){ printf("WARNING: Image failed to load: %s\n", key); shput(loader_state, key, LOADER_FAILED); }
+    else{ shput(loader_state, key, LOADER_CACHED); shput(image_cache, key, image); }
+    return;
+  }
+  if(!loader_start()){ return; }
+
+  char *key = NULL;
+  SDL_LockMutex(LOADER.lock);
+  if(state == LOADER_QUEUED){
+    for(ptrdiff_t i=0; i<arrlen(LOADER.queue); i++){
+      if(strcmp(LOADER.queue[i], fn) == 0){ key = LOADER.queue[i]; arrdel(LOADER.queue, i); break; }
+    }
+    if(key == NULL){ SDL_UnlockMutex(LOADER.lock); return; } // Being decoded already
+  }else{
+    key = malloc(strlen(fn) + 1);
+    strcpy(key, fn);
+    shput(loader_state, key, LOADER_QUEUED);
+  }
+  arrput(LOADER.queue, key);
+  SDL_CondSignal(LOADER.wake);
+  SDL_UnlockMutex(LOADER.lock);
+}
+
+// Files every image decoded since the last call in image_cache. Returns how
+// many arrived.
+uint32_t loader_collect(void){
+  if(LOADER.thread == NULL){ return 0; }
+  SDL_LockMutex(LOADER.lock);
+  loaded_image_t *done = LOADER.done;
+  LOADER.done = NULL;
+  SDL_UnlockMutex(LOADER.lock);
+
+  uint32_t count = 0;
+  for(ptrdiff_t i=0; i<arrlen(done); i++){
+    if(done[i].image == NULL){
+      printf("WARNING: Image failed to load: %s\n", done[i].fn);
+      shput(loader_state, done[i].fn, LOADER_FAILED);
+      continue;
+    }
+    shput(loader_state, done[i].fn, LOADER_CACHED);
+    shput(image_cache, done[i].fn, done[i].image);
+    count += 1;
+  }
+  arrfree(done);
+  return count;
+}
+
+// The image if it is ready, without waiting; NULL while it is still loading.
+SDL_Surface *loader_get(const char *fn){
+  return shget(image_cache, fn);
+}
+
+// Drops every streamed image, cached or still waiting to be decoded, that is
+// not named in keep. Surfaces dropped are freed, so nothing may still point
+// at them. An image being decoded right now is cached when it arrives and
+// dropped by the next call.
+void loader_keep(const char **keep, size_t count){
+  char **drop = NULL;
+  for(ptrdiff_t i=0; i<shlen(loader_state); i++){
+    if(loader_state[i].value != LOADER_CACHED && loader_state[i].value != LOADER_QUEUED){ continue; }
+    bool wanted = false;
+    for(size_t k=0; k<count && !wanted; k++){ wanted = keep[k] != NULL && strcmp(keep[k], loader_state[i].key) == 0; }
+    if(!wanted){ arrput(drop, loader_state[i].key); }
+  }
+
+  for(ptrdiff_t i=0; i<arrlen(drop); i++){
+    char *key = drop[i];
+    if(shget(loader_state, key) == LOADER_QUEUED){
+      bool waiting = false;
+      SDL_LockMutex(LOADER.lock);
+      for(ptrdiff_t j=0; j<arrlen(LOADER.queue); j++){
+        if(LOADER.queue[j] == key){ arrdel(LOADER.queue, j); waiting = true; break; }
+      }
+      SDL_UnlockMutex(LOADER.lock);
+      if(!waiting){ continue; } // The worker has it
+    }else{
+      SDL_FreeSurface(shget(image_cache, key));
+      (void)shdel(image_cache, key);
+    }
+    (void)shdel(loader_state, key);
+    free(key);
+  }
+  arrfree(drop);
+}
+
+void loader_finish(void){
+  if(LOADER.thread == NULL){ return; }
+  SDL_LockMutex(LOADER.lock);
+  LOADER.quit = true;
+  SDL_CondSignal(LOADER.wake);
+  SDL_UnlockMutex(LOADER.lock);
+  SDL_WaitThread(LOADER.thread, NULL);
+  LOADER.thread = NULL;
+}
@@ -0,0 +1,332 @@
+#pragma once
+
+// Pixel kernels for RGBA8888 rows (alpha in the low byte). Each kernel has a
+// scalar version and, on x86, SSE2 and AVX2 versions; pixel_init() picks
+// the best one the CPU supports. All versions give bit-identical results.
+//
+// Blending rounds exactly like dividing by 255:
+//   x = s*a + d*(255-a) + 128;  out = (x + (x >> 8)) >> 8
+// with the alpha lane treated as s = 255, so drawing over an opaque pixel
+// leaves it opaque. The products fit in 16 bits, which is what lets the
+// vector versions work on 16-bit lanes.
+
+#if defined(__x86_64__) || defined(__i386__)
+#define PIXEL_X86
+#include <immintrin.h>
+#endif
+
+typedef void (*pixel_blend_fn)(uint32_t *dst, const uint32_t *src, size_t n);
+typedef void (*pixel_fade_fn)(uint32_t *dst, const uint32_t *src, size_t n, uint8_t alpha);
+typedef void (*pixel_scale_fn)(uint32_t *dst, const uint32_t *src, size_t n, uint32_t scale);
+
+static inline uint32_t pixel_mix(uint32_t s, uint32_t d, uint32_t a){
+  uint32_t x = s*a + d*(255-a) + 128;
+  return (x + (x >> 8)) >> 8;
+}
+
+// Alpha blends one pixel over another.
+static inline uint32_t pixel_over(uint32_t src, uint32_t dst){
+  uint32_t a = src & 0xFF;
+  if(a == 0x00){ return dst; }
+  if(a == 0xFF){ return src; }
+  return (pixel_mix(src >> 24, dst >> 24, a) << 24) | (pixel_mix((src >> 16) & 0xFF, (dst >> 16) & 0xFF, a) << 16) |
+         (pixel_mix((src >> 8) & 0xFF, (dst >> 8) & 0xFF, a) << 8) | pixel_mix(255, dst & 0xFF, a);
+}
+
+// Blends one pixel over another at a fixed alpha, ignoring the source's own.
+static inline uint32_t pixel_over_const(uint32_t src, uint32_t dst, uint32_t a){
+  return pixel_over((src & 0xFFFFFF00) | a, dst);
+}
+
+//////////////////////////// SCALAR ////////////////////////////
+
+// Plain copies are left to memcpy, which is already vectorized.
+void pixel_copy(uint32_t *dst, const uint32_t *src, size_t n){
+  memcpy(dst, src, n*sizeof(uint32_t));
+}
+
+static void pixel_blend_scalar(uint32_t *dst, const uint32_t *src, size_t n){
+  for(size_t i=0; i<n; i++){ dst[i] = pixel_over(src[i], dst[i]); }
+}
+
+static void pixel_fade_scalar(uint32_t *dst, const uint32_t *src, size_t n, uint8_t alpha){
+  for(size_t i=0; i<n; i++){ dst[i] = pixel_over_const(src[i], dst[i], alpha); }
+}
+
+static void pixel_scale_scalar(uint32_t *dst, const uint32_t *src, size_t n, uint32_t scale){
+  for(size_t i=0; i<n; i++){
+    for(uint32_t j=0; j<scale; j++){ *dst++ = src[i]; }
+  }
+}
+
+///////////////////////////// SSE2 /////////////////////////////
+
+#ifdef PIXEL_X86
+
+// s*a + d*(255-a) + 128, rounded down by 255, on eight 16-bit lanes.
+__attribute__((target("sse2")))
+static inline __m128i pixel_mix_sse2(__m128i s, __m128i d, __m128i a){
+  __m128i x = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(s, a), _mm_mullo_epi16(d, _mm_sub_epi16(_mm_set1_epi16(255), a))), _mm_set1_epi16(128));
+  return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+// Blends four pixels; a holds each pixel's alpha in all four of its lanes.
+__attribute__((target("sse2")))
+static inline __m128i pixel_over_sse2(__m128i s, __m128i d, __m128i a_lo, __m128i a_hi){
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i alpha_lane = _mm_set_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+  __m128i s_lo = _mm_or_si128(_mm_unpacklo_epi8(s, zero), alpha_lane);
+  __m128i s_hi = _mm_or_si128(_mm_unpackhi_epi8(s, zero), alpha_lane);
+  __m128i lo = pixel_mix_sse2(s_lo, _mm_unpacklo_epi8(d, zero), a_lo);
+  __m128i hi = pixel_mix_sse2(s_hi, _mm_unpackhi_epi8(d, zero), a_hi);
+  return _mm_packus_epi16(lo, hi);
+}
+
+__attribute__((target("sse2")))
+static void pixel_blend_sse2(uint32_t *dst, const uint32_t *src, size_t n){
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = 0;
+  for(; i+4<=n; i+=4){
+    __m128i s = _mm_loadu_si128((const __m128i *)&src[i]);
+    __m128i d = _mm_loadu_si128((const __m128i *)&dst[i]);
+    __m128i a_lo = _mm_unpacklo_epi8(s, zero);
+    __m128i a_hi = _mm_unpackhi_epi8(s, zero);
+    a_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(a_lo, 0x00), 0x00);
+    a_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(a_hi, 0x00), 0x00);
+    _mm_storeu_si128((__m128i *)&dst[i], pixel_over_sse2(s, d, a_lo, a_hi));
+  }
+  pixel_blend_scalar(&dst[i], &src[i], n-i);
+}
+
+__attribute__((target("sse2")))
+static void pixel_fade_sse2(uint32_t *dst, const uint32_t *src, size_t n, uint8_t alpha){
+  const __m128i a = _mm_set1_epi16(alpha);
+  size_t i = 0;
+  for(; i+4<=n; i+=4){
+    __m128i s = _mm_loadu_si128((const __m128i *)&src[i]);
+    __m128i d = _mm_loadu_si128((const __m128i *)&dst[i]);
+    _mm_storeu_si128((__m128i *)&dst[i], pixel_over_sse2(s, d, a, a));
+  }
+  pixel_fade_scalar(&dst[i], &src[i], n-i, alpha);
+}
+
+// The common scales get a fixed shuffle per output vector; the rest are left
+// to the scalar version.
+__attribute__((target("sse2")))
+static void pixel_scale_sse2(uint32_t *dst, const uint32_t *src, size_t n, uint32_t scale){
+  size_t i = 0;
+  if(scale == 2){
+    for(; i+4<=n; i+=4, dst+=8){
+      __m128i v = _mm_loadu_si128((const __m128i *)&src[i]);
+      _mm_storeu_si128((__m128i *)&dst[0], _mm_unpacklo_epi32(v, v));
+      _mm_storeu_si128((__m128i *)&dst[4], _mm_unpackhi_epi32(v, v));
+    }
+  }else if(scale == 3){
+    for(; i+4<=n; i+=4, dst+=12){
+      __m128i v = _mm_loadu_si128((const __m128i *)&src[i]);
+      _mm_storeu_si128((__m128i *)&dst[0], _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 0, 0)));
+      _mm_storeu_si128((__m128i *)&dst[4], _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 2, 1, 1)));
+      _mm_storeu_si128((__m128i *)&dst[8], _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 2)));
+    }
+  }else if(scale == 4){
+    for(; i+4<=n; i+=4, dst+=16){
+      __m128i v = _mm_loadu_si128((const __m128i *)&src[i]);
+      _mm_storeu_si128((__m128i *)&dst[0], _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 0, 0, 0)));
+      _mm_storeu_si128((__m128i *)&dst[4], _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 1, 1)));
+      _mm_storeu_si128((__m128i *)&dst[8], _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 2, 2, 2)));
+      _mm_storeu_si128((__m128i *)&dst[12], _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+  }
+  pixel_scale_scalar(dst, &src[i], n-i, scale);
+}
+
+///////////////////////////// AVX2 /////////////////////////////
+
+__attribute__((target("avx2")))
+static inline __m256i pixel_mix_avx2(__m256i s, __m256i d, __m256i a){
+  __m256i x = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(s, a), _mm256_mullo_epi16(d, _mm256_sub_epi16(_mm256_set1_epi16(255), a))), _mm256_set1_epi16(128));
+  return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+
+// Same as pixel_over_sse2 on eight pixels; unpacking stays within each
+// 128-bit half, and packing puts the halves back in the same order.
+__attribute__((target("avx2")))
+static inline __m256i pixel_over_avx2(__m256i s, __m256i d, __m256i a_lo, __m256i a_hi){
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i alpha_lane = _mm256_set_epi16(0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255);
+  __m256i s_lo = _mm256_or_si256(_mm256_unpacklo_epi8(s, zero), alpha_lane);
+  __m256i s_hi = _mm256_or_si256(_mm256_unpackhi_epi8(s, zero), alpha_lane);
+  __m256i lo = pixel_mix_avx2(s_lo, _mm256_unpacklo_epi8(d, zero), a_lo);
+  __m256i hi = pixel_mix_avx2(s_hi, _mm256_unpackhi_epi8(d, zero), a_hi);
+  return _mm256_packus_epi16(lo, hi);
+}
+
+__attribute__((target("avx2")))
+static void pixel_blend_avx2(uint32_t *dst, const uint32_t *src, size_t n){
+  const __m256i zero = _mm256_setzero_si256();
+  size_t i = 0;
+  for(; i+8<=n; i+=8){
+    __m256i s = _mm256_loadu_si256((const __m256i *)&src[i]);
+    __m256i d = _mm256_loadu_si256((const __m256i *)&dst[i]);
+    __m256i a_lo = _mm256_unpacklo_epi8(s, zero);
+    __m256i a_hi = _mm256_unpackhi_epi8(s, zero);
+    a_lo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(a_lo, 0x00), 0x00);
+    a_hi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(a_hi, 0x00), 0x00);
+    _mm256_storeu_si256((__m256i *)&dst[i], pixel_over_avx2(s, d, a_lo, a_hi));
+  }
+  pixel_blend_sse2(&dst[i], &src[i], n-i);
+}
+
+__attribute__((target("avx2")))
+static void pixel_fade_avx2(uint32_t *dst, const uint32_t *src, size_t n, uint8_t alpha){
+  const __m256i a = _mm256_set1_epi16(alpha);
+  size_t i = 0;
+  for(; i+8<=n; i+=8){
+    __m256i s = _mm256_loadu_si256((const __m256i *)&src[i]);
+    __m256i d = _mm256_loadu_si256((const __m256i *)&dst[i]);
+    _mm256_storeu_si256((__m256i *)&dst[i], pixel_over_avx2(s, d, a, a));
+  }
+  pixel_fade_sse2(&dst[i], &src[i], n-i, alpha);
+}
+
+// Any scale up to 8: each output vector is eight pixels gathered from the
+// eight source pixels at base by a permute. Which permute depends only on
+// where the vector starts within a source pixel's run, its phase, so there
+// are scale of them, and the base and phase of the next vector are looked up
+// too rather than divided out.
+__attribute__((target("avx2")))
+static void pixel_scale_avx2(uint32_t *dst, const uint32_t *src, size_t n, uint32_t scale){
+  if(scale < 2 || scale > 8){ pixel_scale_sse2(dst, src, n, scale); return; }
+  __m256i perm[8];
+  uint32_t next_base[8], next_phase[8];
+  for(uint32_t p=0; p<scale; p++){
+    int32_t idx[8];
+    for(uint32_t j=0; j<8; j++){ idx[j] = (p + j) / scale; }
+    perm[p] = _mm256_loadu_si256((const __m256i *)idx);
+    next_base[p] = (p + 8) / scale;
+    next_phase[p] = (p + 8) % scale;
+  }
+  size_t base = 0, out = 0, total = n * scale;
+  uint32_t phase = 0;
+  while(base + 8 <= n && out + 8 <= total){
+    __m256i v = _mm256_loadu_si256((const __m256i *)&src[base]);
+    _mm256_storeu_si256((__m256i *)&dst[out], _mm256_permutevar8x32_epi32(v, perm[phase]));
+    out += 8;
+    base += next_base[phase];
+    phase = next_phase[phase];
+  }
+  for(; out<total; out++){ dst[out] = src[out / scale]; }
+}
+
+#endif // PIXEL_X86
+
+/////////////////////////// DISPATCH ///////////////////////////
+
+// Blends src over dst using the alpha of each src pixel.
+static pixel_blend_fn pixel_blend = pixel_blend_scalar;
+// Blends src over dst at one alpha for every pixel, as for a fade.
+static pixel_fade_fn pixel_fade = pixel_fade_scalar;
+// Writes each of n src pixels scale times over, for nearest neighbor upscaling.
+static pixel_scale_fn pixel_scale = pixel_scale_scalar;
+
+static const char *PIXEL_PATH = "scalar";
+
+void pixel_init(void){
+#ifdef PIXEL_X86
+  if(SDL_HasSSE2()){
+    pixel_blend = pixel_blend_sse2; pixel_fade = pixel_fade_sse2; pixel_scale = pixel_scale_sse2;
+    PIXEL_PATH = "sse2";
+  }
+  if(SDL_HasAVX2()){
+    pixel_blend = pixel_blend_avx2; pixel_fade = pixel_fade_avx2; pixel_scale = pixel_scale_avx2;
+    PIXEL_PATH = "avx2";
+  }
+#endif
+}
+
+////////////////////////// SURFACES ///////////////////////////
+
+static inline uint32_t *surface_row(SDL_Surface *s, int32_t y){
+  return (uint32_t *)((uint8_t *)s->pixels + y*s->pitch);
+}
+
+// Works out which part of a w by h image placed at (*x,*y) lands inside the
+// clip rect of dst. Moves (*x,*y) to the first pixel drawn and returns the
+// source rect to draw, empty if nothing is.
+static SDL_Rect surface_clip(SDL_Surface *dst, int32_t *x, int32_t *y, int32_t w, int32_t h){
+  const SDL_Rect *clip = &dst->clip_rect;
+  int32_t x0 = *x > clip->x ? *x : clip->x;
+  int32_t y0 = *y > clip->y ? *y : clip->y;
+  int32_t x1 = *x + w < clip->x + clip->w ? *x + w : clip->x + clip->w;
+  int32_t y1 = *y + h < clip->y + clip->h ? *y + h : clip->y + clip->h;
+  SDL_Rect r = { x0 - *x, y0 - *y, x1 > x0 ? x1 - x0 : 0, y1 > y0 ? y1 - y0 : 0 };
+  *x = x0; *y = y0;
+  return r;
+}
+
+// Copies src onto dst at (x,y), alpha and all.
+void surface_copy(SDL_Surface *src, SDL_Surface *dst, int32_t x, int32_t y){
+  SDL_Rect r = surface_clip(dst, &x, &y, src->w, src->h);
+  for(int32_t i=0; i<r.h; i++){ pixel_copy(surface_row(dst, y+i) + x, surface_row(src, r.y+i) + r.x, r.w); }
+}
+
+// Blends src onto dst at (x,y) by its per-pixel alpha.
+void surface_blend(SDL_Surface *src, SDL_Surface *dst, int32_t x, int32_t y){
+  SDL_Rect r = surface_clip(dst, &x, &y, src->w, src->h);
+  for(int32_t i=0; i<r.h; i++){ pixel_blend(surface_row(dst, y+i) + x, surface_row(src, r.y+i) + r.x, r.w); }
+}
+
+// Blends src onto dst at (x,y) with the same alpha for every pixel.
+void surface_fade(SDL_Surface *src, SDL_Surface *dst, int32_t x, int32_t y, uint8_t alpha){
+  SDL_Rect r = surface_clip(dst, &x, &y, src->w, src->h);
+  for(int32_t i=0; i<r.h; i++){ pixel_fade(surface_row(dst, y+i) + x, surface_row(src, r.y+i) + r.x, r.w, alpha); }
+}
+
+/////////////////////////// SELF TEST ///////////////////////////
+
+#ifdef DEBUG
+// Checks that every kernel the CPU can run matches the scalar one, bit for
+// bit, over random pixels and odd lengths that exercise the tails.
+bool pixel_self_test(void){
+  enum { N = 1031 };
+  enum { MAX_SCALE = 9 };
+  static uint32_t src[N], dst[N], want[N], got[N], want_wide[N*MAX_SCALE], got_wide[N*MAX_SCALE];
+  uint32_t seed = 12345;
+  for(size_t i=0; i<N; i++){
+    seed = seed*1664525u + 1013904223u; src[i] = seed;
+    seed = seed*1664525u + 1013904223u; dst[i] = seed;
+  }
+  src[0] &= 0xFFFFFF00; src[1] |= 0xFF; // both ends of the alpha range
+
+  struct { const char *name; pixel_blend_fn blend; pixel_fade_fn fade; pixel_scale_fn scale; bool ok; } paths[] = {
+#ifdef PIXEL_X86
+    { "sse2", pixel_blend_sse2, pixel_fade_sse2, pixel_scale_sse2, SDL_HasSSE2() },
+    { "avx2", pixel_blend_avx2, pixel_fade_avx2, pixel_scale_avx2, SDL_HasAVX2() },
+#endif
+    { "scalar", pixel_blend_scalar, pixel_fade_scalar, pixel_scale_scalar, true },
+  };
+
+  bool pass = true;
+  for(size_t p=0; p<sizeof(paths)/sizeof(paths[0]); p++){
+    if(!paths[p].ok){ continue; }
+    for(size_t n=N-8; n<=N; n++){
+      memcpy(want, dst, sizeof(dst)); pixel_blend_scalar(want, src, n);
+      memcpy(got, dst, sizeof(dst)); paths[p].blend(got, src, n);
+      if(memcmp(want, got, sizeof(got)) != 0){ printf("ERROR: pixel_self_test: %s blend differs (n=%zu)\n", paths[p].name, n); pass = false; }
+
+      for(uint32_t a=0; a<256; a+=51){
+        memcpy(want, dst, sizeof(dst)); pixel_fade_scalar(want, src, n, a);
+        memcpy(got, dst, sizeof(dst)); paths[p].fade(got, src, n, a);
+        if(memcmp(want, got, sizeof(got)) != 0){ printf("ERROR: pixel_self_test: %s fade differs (n=%zu a=%u)\n", paths[p].name, n, a); pass = false; }
+      }
+
+      for(uint32_t k=1; k<=MAX_SCALE; k++){
+        memset(want_wide, 0, sizeof(want_wide)); pixel_scale_scalar(want_wide, src, n, k);
+        memset(got_wide, 0, sizeof(got_wide)); paths[p].scale(got_wide, src, n, k);
+        if(memcmp(want_wide, got_wide, sizeof(got_wide)) != 0){ printf("ERROR: pixel_self_test: %s scale differs (n=%zu scale=%u)\n", paths[p].name, n, k); pass = false; }
+      }
+    }
+  }
+  return pass;
+}
+#endif
@@ -0,0 +1,79 @@
+#pragma once
+
+// The rules of play: what the player can see, what they can use, and where
+// choosing an option takes them. Nothing in here touches SDL, so the same
+// rules drive both the game and the headless explorer (tools/explore.c).
+
+#define MAX_OPTIONS 6
+
+typedef struct player_t {
+  const node_t *cur_node;
+  tagset_t tags;
+} player_t;
+
+typedef struct choice_t {
+  const node_t *node;   // the node offered in this slot, NULL if the slot is empty
+  const node_t *target; // where choosing it leads, NULL while it is locked
+  uint8_t number;       // the number shown in front of the option
+} choice_t;
+
+// FLAG_NONE is never set, so an absent rehide condition needs no test of its own.
+static inline int node_is_hidden(const tagset_t *tags, const node_t *n){
+  return (n->type == NT_NONE) ||
+         (n->revealed_by != FLAG_NONE && !tagset_has(tags, n->revealed_by)) ||
+         tagset_has(tags, n->rehidden_by);
+}
+
+static inline int node_is_locked(const tagset_t *tags, const node_t *n){
+  return (n->unlocked_by != FLAG_NONE) && !tagset_has(tags, n->unlocked_by);
+}
+
+int node_all_hidden(const tagset_t *tags, const node_t *n){
+  for(size_t i=0;i<MAX_CHILDREN;i++){
+    if(node_is_hidden(tags, node_at(n->children[i]))){
+      continue;
+    }else{ return 0; }
+  }
+  return 1;
+}
+
+int node_all_locked(const tagset_t *tags, const node_t *n){
+  for(size_t i=0;i<MAX_CHILDREN;i++){
+    if(node_is_locked(tags, node_at(n->children[i]))){
+      continue;
+    }else{ return 0; }
+  }
+  return 1;
+}
+
+// Moves the player onto next. Items and flags are taken on the spot and send
+// the player back to their parent, as does a case or lock with nothing left
+// in it. Returns where the player moves on the following step, or NULL once
+// next is the scene in front of them.
+const node_t *player_enter(player_t *p, const node_t *next){
+  p->cur_node = next;
+  if(next->type == NT_ITEM || next->type == NT_FLAG){
+    tagset_add(&p->tags, next->flag);
+    return node_at(next->parent);
+  }
+  if((next->type == NT_CASE || next->type == NT_LOCK) && node_all_hidden(&p->tags, next)){
+    return node_at(next->parent);
+  }
+  return NULL;
+}
+
+// Lays out a scene's options as the player sees them: the visible children
+// packed to the top in order, and the way back always in the last slot.
+void node_choices(const node_t *n, const tagset_t *tags, choice_t choices[MAX_OPTIONS]){
+  memset(choices, 0, sizeof(choice_t)*MAX_OPTIONS);
+  size_t oi=0;
+  for(size_t i=0;i<MAX_OPTIONS;i++){
+    choice_t *c = &choices[i<MAX_CHILDREN ? oi : MAX_OPTIONS-1];
+    const node_t *child = node_at(i<MAX_CHILDREN ? n->children[i] : n->parent);
+    if(node_is_hidden(tags, child)){ continue; }
+    oi += 1;
+    c->node = child;
+    c->number = i+1;
+    c->target = node_is_locked(tags, child) ? NULL : child;
+  }
+}
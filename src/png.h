@@ -0,0 +1,161 @@
+#pragma once
+
+// Writes RGBA8888 surfaces out as PNG, or a run of them as one animated PNG.
+// The image data goes in stored (uncompressed) deflate blocks, so no zlib is
+// needed; a 320x240 frame comes to about 300 KB.
+
+static uint32_t png_crc_table[256];
+
+static uint32_t png_crc(uint32_t crc, const uint8_t *p, size_t n){
+  if(png_crc_table[1] == 0){
+    for(uint32_t i=0; i<256; i++){
+      uint32_t c = i;
+      for(int k=0; k<8; k++){ c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1; }
+      png_crc_table[i] = c;
+    }
+  }
+  crc = ~crc;
+  for(size_t i=0; i<n; i++){ crc = png_crc_table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8); }
+  return ~crc;
+}
+
+static void png_put32(uint8_t *p, uint32_t v){
+  p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+static void png_chunk(FILE *fp, const char *type, const uint8_t *data, uint32_t n){
+  uint8_t head[8];
+  png_put32(head, n);
+  memcpy(head + 4, type, 4);
+  uint8_t tail[4];
+  png_put32(tail, png_crc(png_crc(0, head + 4, 4), data, n));
+  fwrite(head, 1, 8, fp);
+  fwrite(data, 1, n, fp);
+  fwrite(tail, 1, 4, fp);
+}
+
+// The zlib stream of an image: each row is a filter byte of 0 and then its
+// pixels as R, G, B, A, split into stored blocks of up to 65535 bytes.
+// Returns an stb_ds array; free it with arrfree.
+static uint8_t *png_image_data(SDL_Surface *image){
+  size_t row_len = 1 + (size_t)image->w * 4;
+  size_t raw_len = row_len * image->h;
+  uint8_t *raw = malloc(raw_len);
+  for(int32_t y=0; y<image->h; y++){
+    uint8_t *p = raw + y * row_len;
+    const uint32_t *row = surface_row(image, y);
+    *p++ = 0;
+    for(int32_t x=0; x<image->w; x++, p+=4){ png_put32(p, row[x]); }
+  }
+
+  uint8_t *z = NULL;
+  arrsetcap(z, raw_len + raw_len / 65535 * 5 + 11);
+  arrput(z, 0x78); arrput(z, 0x01);
+  size_t at = 0;
+  do{
+    uint32_t n = raw_len - at > 65535 ? 65535 : raw_len - at;
+    arrput(z, at + n == raw_len);
+    arrput(z, n & 0xFF); arrput(z, n >> 8);
+    arrput(z, ~n & 0xFF); arrput(z, (~n >> 8) & 0xFF);
+    memcpy(arraddnptr(z, n), raw + at, n);
+    at += n;
+  }while(at < raw_len);
+
+  uint32_t a = 1, b = 0;
+  for(size_t i=0; i<raw_len; i++){ a = (a + raw[i]) % 65521; b = (b + a) % 65521; }
+  png_put32(arraddnptr(z, 4), (b << 16) | a);
+  free(raw);
+  return z;
+}
+
+static void png_header(FILE *fp, int32_t w, int32_t h){
+  static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+  uint8_t ihdr[13] = { 0 };
+  png_put32(ihdr, w);
+  png_put32(ihdr + 4, h);
+  ihdr[8] = 8; // bits per channel
+  ihdr[9] = 6; // RGBA
+  fwrite(signature, 1, 8, fp);
+  png_chunk(fp, "IHDR", ihdr, 13);
+}
+
+bool png_write(const char *fn, SDL_Surface *image){
+  FILE *fp = fopen(fn, "wb");
+  if(fp == NULL){ fprintf(stderr, "ERROR: Cannot write %s\n", fn); return false; }
+  png_header(fp, image->w, image->h);
+  uint8_t *z = png_image_data(image);
+  png_chunk(fp, "IDAT", z, arrlen(z));
+  arrfree(z);
+  png_chunk(fp, "IEND", NULL, 0);
+  bool ok = !ferror(fp);
+  if(fclose(fp) != 0){ ok = false; }
+  if(!ok){ fprintf(stderr, "ERROR: Failed writing %s\n", fn); }
+  return ok;
+}
+
+// An animated PNG being written, one frame at a time. The frame count in
+// its acTL chunk is only known at the end, so it is patched in then.
+typedef struct {
+  FILE *fp;
+  const char *fn;
+  int32_t w, h;
+  uint32_t frames;
+  uint32_t seq;  // next fcTL/fdAT sequence number
+} apng_t;
+
+#define APNG_ACTL_AT 33 // the signature and IHDR come before it
+
+static void apng_actl(apng_t *a){
+  uint8_t actl[8];
+  png_put32(actl, a->frames);
+  png_put32(actl + 4, 0); // loop forever
+  png_chunk(a->fp, "acTL", actl, 8);
+}
+
+bool apng_begin(apng_t *a, const char *fn, int32_t w, int32_t h){
+  memset(a, 0, sizeof(apng_t));
+  a->fn = fn; a->w = w; a->h = h;
+  a->fp = fopen(fn, "wb");
+  if(a->fp == NULL){ fprintf(stderr, "ERROR: Cannot write %s\n", fn); return false; }
+  png_header(a->fp, w, h);
+  apng_actl(a);
+  return true;
+}
+
+// Adds a frame shown for delay_num/delay_den seconds. The first is also the
+// still image viewers without APNG support show.
+void apng_frame(apng_t *a, SDL_Surface *image, uint16_t delay_num, uint16_t delay_den){
+  uint8_t fctl[26] = { 0 };
+  png_put32(fctl, a->seq++);
+  png_put32(fctl + 4, a->w);
+  png_put32(fctl + 8, a->h);
+  fctl[20] = delay_num >> 8; fctl[21] = delay_num & 0xFF;
+  fctl[22] = delay_den >> 8; fctl[23] = delay_den & 0xFF;
+  png_chunk(a->fp, "fcTL", fctl, 26); // offsets, dispose and blend ops all 0
+
+  uint8_t *z = png_image_data(image);
+  if(a->frames == 0){
+    png_chunk(a->fp, "IDAT", z, arrlen(z));
+  }else{
+    // fdAT is IDAT with a sequence number in front.
+    uint8_t *fdat = malloc(arrlen(z) + 4);
+    png_put32(fdat, a->seq++);
+    memcpy(fdat + 4, z, arrlen(z));
+    png_chunk(a->fp, "fdAT", fdat, arrlen(z) + 4);
+    free(fdat);
+  }
+  arrfree(z);
+  a->frames += 1;
+}
+
+bool apng_end(apng_t *a){
+  if(a->fp == NULL){ return false; }
+  png_chunk(a->fp, "IEND", NULL, 0);
+  fseek(a->fp, APNG_ACTL_AT, SEEK_SET);
+  apng_actl(a);
+  bool ok = !ferror(a->fp) && a->frames > 0;
+  if(fclose(a->fp) != 0){ ok = false; }
+  a->fp = NULL;
+  if(!ok){ fprintf(stderr, "ERROR: Failed writing %s\n", a->fn); }
+  return ok;
+}
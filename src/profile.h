@@ -0,0 +1,121 @@
+#pragma once
+
+// A frame profiler. Code to be timed is wrapped in a zone:
+//
+//   PROFILE_ZONE(ZONE_INPUT){ controller_read(); }
+//
+// Each zone's time is summed per frame into a ring of the last PROFILE_FRAMES
+// frames, for the overlay, and every zone entered is logged to a ring of the
+// last PROFILE_EVENTS events, for the trace file. All of it is allocated up
+// front. While PROFILE.on is false a zone costs one well-predicted branch.
+
+#define PROFILE_FRAMES 256
+#define PROFILE_EVENTS 16384
+
+typedef enum {
+  ZONE_INPUT,      // controller_read
+  ZONE_UPDATE,     // player_update_node
+  ZONE_BACKGROUND, // background blit
+  ZONE_TEXT,       // text and cursor drawing
+  ZONE_FADE,       // the fade from the last scene
+  ZONE_UPLOAD,     // handing the frame over to the renderer
+  ZONE_PRESENT,    // SDL_RenderPresent
+  ZONE_CAPTURE,    // copying the frame into the capture ring
+  ZONE_COUNT
+} zone_t;
+
+static const char *zone_names[ZONE_COUNT] = { "input", "update", "background", "text", "fade", "upload", "present", "capture" };
+
+typedef struct {
+  uint64_t start; // performance counter when the zone was entered
+  uint32_t ticks; // performance counter ticks spent in it
+  uint8_t zone;
+} profile_event_t;
+
+static struct {
+  bool on;
+  bool starting;                               // turns on at the next frame
+  bool hud;                                    // the overlay is drawn on the frame
+  uint64_t freq;                               // performance counter ticks per second
+  uint64_t origin;                             // performance counter when profiling began
+  uint32_t frame_ticks[PROFILE_FRAMES][ZONE_COUNT];
+  uint32_t frame;                              // frames finished since profiling began
+  profile_event_t events[PROFILE_EVENTS];
+  uint32_t event;                              // events logged since profiling began
+} PROFILE;
+
+// Profiling begins with the next frame. Turning it on at once could land
+// inside a zone, which would then end with no start time.
+void profile_start(void){
+  if(!PROFILE.on){ PROFILE.starting = true; }
+}
+
+static inline uint64_t profile_begin(void){
+  return PROFILE.on ? SDL_GetPerformanceCounter() : 0;
+}
+
+static inline void profile_end(zone_t zone, uint64_t start){
+  if(!PROFILE.on){ return; }
+  uint32_t ticks = (uint32_t)(SDL_GetPerformanceCounter() - start);
+  PROFILE.frame_ticks[PROFILE.frame % PROFILE_FRAMES][zone] += ticks;
+  PROFILE.events[PROFILE.event++ % PROFILE_EVENTS] = (profile_event_t){ start, ticks, zone };
+}
+
+// Runs the statement or block after it once, timed as zone.
+#define PROFILE_ZONE(zone) \
+  for(uint64_t pz_start = profile_begin(), pz_once = 1; pz_once; pz_once = 0, profile_end(zone, pz_start))
+
+// Closes the current frame and clears the slot of the next.
+void profile_frame(void){
+  if(!PROFILE.on){
+    if(!PROFILE.starting){ return; }
+    PROFILE.on = true;
+    PROFILE.freq = SDL_GetPerformanceFrequency();
+    PROFILE.origin = SDL_GetPerformanceCounter();
+    return;
+  }
+  PROFILE.frame += 1;
+  memset(PROFILE.frame_ticks[PROFILE.frame % PROFILE_FRAMES], 0, sizeof(PROFILE.frame_ticks[0]));
+}
+
+static int profile_cmp_u32(const void *a, const void *b){
+  uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+  return (x > y) - (x < y);
+}
+
+typedef struct {
+  float min, avg, p99; // microseconds per frame
+} zone_stats_t;
+
+// Statistics of a zone over the finished frames still in the ring.
+zone_stats_t profile_stats(zone_t zone){
+  uint32_t ticks[PROFILE_FRAMES];
+  uint32_t n = PROFILE.frame < PROFILE_FRAMES ? PROFILE.frame : PROFILE_FRAMES - 1;
+  if(n == 0){ return (zone_stats_t){ 0, 0, 0 }; }
+  uint64_t sum = 0;
+  for(uint32_t i=0; i<n; i++){
+    ticks[i] = PROFILE.frame_ticks[(PROFILE.frame - 1 - i) % PROFILE_FRAMES][zone];
+    sum += ticks[i];
+  }
+  qsort(ticks, n, sizeof(uint32_t), profile_cmp_u32);
+  float us = 1e6f / PROFILE.freq;
+  return (zone_stats_t){ ticks[0] * us, (float)sum / n * us, ticks[(n - 1) * 99 / 100] * us };
+}
+
+// Writes the logged events as Chrome trace-event JSON, for chrome://tracing
+// or Perfetto.
+bool profile_write_trace(const char *fn){
+  FILE *fp = fopen(fn, "w");
+  if(fp == NULL){ fprintf(stderr, "ERROR: Cannot write trace %s\n", fn); return false; }
+  uint32_t first = PROFILE.event > PROFILE_EVENTS ? PROFILE.event - PROFILE_EVENTS : 0;
+  double us = 1e6 / PROFILE.freq;
+  fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  for(uint32_t i=first; i<PROFILE.event; i++){
+    const profile_event_t *e = &PROFILE.events[i % PROFILE_EVENTS];
+    fprintf(fp, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}%s\n",
+      zone_names[e->zone], (e->start - PROFILE.origin) * us, e->ticks * us, i+1 < PROFILE.event ? "," : "");
+  }
+  fprintf(fp, "]}\n");
+  fclose(fp);
+  return true;
+}
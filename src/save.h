@@ -0,0 +1,183 @@
+#pragma once
+
+// Saved games. A save is the player's tags and the scene they are in, in a
+// fixed-size record with a checksum; the scene is stored by its idstr, so a
+// save outlives the world being recompiled around it. Files live in SDL's
+// per-user preference directory: one per numbered slot, and an autosave
+// rewritten on every move.
+//
+// Saves are written by a worker thread, to a temporary file that is then
+// renamed over the old one, so the frame never waits on the disk and a
+// crash mid-write leaves the last good save in place.
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define SAVE_MAGIC    0x31565344 // "DSV1" read as a little-endian word
+#define SAVE_VERSION  1
+#define SAVE_AUTOSAVE 0          // the slot autosaves go to
+#define SAVE_ID_SIZE  IDSTR_SIZE // worldc keeps every idstr to this
+
+typedef struct save_t {
+  uint32_t magic;              // SAVE_MAGIC
+  uint32_t version;            // SAVE_VERSION
+  uint32_t tagset_words;       // TAGSET_WORDS of the build that saved it
+  uint32_t flag_count;         // flag bits in the world it was saved in
+  char node[SAVE_ID_SIZE];     // idstr of the scene the player is in
+  uint64_t tags[TAGSET_WORDS];
+  uint32_t checksum;           // FNV-1a of everything before it
+} save_t;
+
+typedef struct {
+  char *fn;
+  int slot;
+  save_t save;
+} save_job_t;
+
+static struct {
+  SDL_Thread *thread;
+  SDL_mutex *lock;
+  SDL_cond *wake;
+  save_job_t *jobs;  // waiting to be written, at most one per file
+  bool quit;
+  char *dir;         // where saves go, with a trailing separator
+} SAVER;
+
+static uint32_t save_checksum(const save_t *s){
+  const uint8_t *p = (const uint8_t *)s;
+  uint32_t h = 2166136261u;
+  for(size_t i=0; i<offsetof(save_t, checksum); i++){ h = (h ^ p[i]) * 16777619u; }
+  return h;
+}
+
+// The file a slot is saved in. The caller frees it.
+static char *save_path(int slot){
+  const char *dir = SAVER.dir != NULL ? SAVER.dir : "";
+  size_t n = strlen(dir) + 32;
+  char *fn = malloc(n);
+  if(slot == SAVE_AUTOSAVE){ snprintf(fn, n, "%sautosave.sav", dir); }
+  else{ snprintf(fn, n, "%sslot-%d.sav", dir, slot); }
+  return fn;
+}
+
+// Writes to fn.tmp and renames it over fn.
+static bool save_write_file(const char *fn, const save_t *s){
+  size_t n = strlen(fn) + 5;
+  char *tmp = malloc(n);
+  snprintf(tmp, n, "%s.tmp", fn);
+  // The new save has to be on the disk before the rename is, or a power cut
+  // can leave an empty file under the old name.
+#ifdef _WIN32
+  FILE *fp = fopen(tmp, "wb");
+  bool ok = fp != NULL && fwrite(s, sizeof(save_t), 1, fp) == 1 && fflush(fp) == 0 && _commit(_fileno(fp)) == 0;
+  if(fp != NULL && fclose(fp) != 0){ ok = false; }
+  if(ok){ ok = MoveFileExA(tmp, fn, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH); }
+#else
+  int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  bool ok = fd >= 0 && write(fd, s, sizeof(save_t)) == (ssize_t)sizeof(save_t) && fsync(fd) == 0;
+  if(fd >= 0 && close(fd) != 0){ ok = false; }
+  if(ok){ ok = rename(tmp, fn) == 0; }
+#endif
+  if(!ok){ printf("WARNING: Cannot save to %s\n", fn); remove(tmp); }
+  free(tmp);
+  return ok;
+}
+
+static int save_main(void *data){
+  (void)(data); // Suppress unused warning
+  SDL_LockMutex(SAVER.lock);
+  while(true){
+    while(!SAVER.quit && arrlen(SAVER.jobs) == 0){ SDL_CondWait(SAVER.wake, SAVER.lock); }
+    if(arrlen(SAVER.jobs) == 0){ break; } // Quitting, and all written
+    save_job_t job = SAVER.jobs[0];
+    arrdel(SAVER.jobs, 0);
+    SDL_UnlockMutex(SAVER.lock);
+
+    // Only saves asked for are reported, once they are on disk; autosaves go quietly.
+    if(save_write_file(job.fn, &job.save) && job.slot != SAVE_AUTOSAVE){ printf("Saved to slot %d\n", job.slot); fflush(stdout); }
+    free(job.fn);
+
+    SDL_LockMutex(SAVER.lock);
+  }
+  SDL_UnlockMutex(SAVER.lock);
+  return 0;
+}
+
+static bool save_start(void){
+  if(SAVER.thread != NULL){ return true; }
+  if(SAVER.dir == NULL){ SAVER.dir = SDL_GetPrefPath("outpost", "odv9"); }
+  if(SAVER.dir == NULL){ printf("WARNING: No directory for saves (%s), using the current one.\n", SDL_GetError()); }
+  SAVER.lock = SDL_CreateMutex();
+  SAVER.wake = SDL_CreateCond();
+  SAVER.thread = SDL_CreateThread(save_main, "saver", NULL);
+  if(SAVER.thread == NULL){
+    fprintf(stderr, "ERROR: save_start: %s\n", SDL_GetError());
+    return false;
+  }
+  return true;
+}
+
+// Hands the player's progress to the worker to be saved in slot. A save to
+// the same slot still waiting to be written is replaced, not queued behind.
+void save_player(const player_t *p, int slot){
+  if(!save_start()){ return; }
+  save_t s;
+  memset(&s, 0, sizeof(save_t));
+  s.magic = SAVE_MAGIC;
+  s.version = SAVE_VERSION;
+  s.tagset_words = TAGSET_WORDS;
+  s.flag_count = WORLD.flag_count;
+  snprintf(s.node, SAVE_ID_SIZE, "%s", world_str(p->cur_node->idstr));
+  memcpy(s.tags, p->tags.w, sizeof(s.tags));
+  s.checksum = save_checksum(&s);
+
+  char *fn = save_path(slot);
+  SDL_LockMutex(SAVER.lock);
+  ptrdiff_t i = 0;
+  while(i < arrlen(SAVER.jobs) && strcmp(SAVER.jobs[i].fn, fn) != 0){ i++; }
+  if(i < arrlen(SAVER.jobs)){ SAVER.jobs[i].save = s; free(fn); }
+  else{ arrput(SAVER.jobs, ((save_job_t){ fn, slot, s })); }
+  SDL_CondSignal(SAVER.wake);
+  SDL_UnlockMutex(SAVER.lock);
+}
+
+// Reads slot back into p. Returns the scene to rebuild, or NULL if the slot
+// is empty or its save cannot be used with this build and world.
+const node_t *save_load(player_t *p, int slot){
+  if(SAVER.dir == NULL){ SAVER.dir = SDL_GetPrefPath("outpost", "odv9"); }
+  char *fn = save_path(slot);
+  save_t s;
+  FILE *fp = fopen(fn, "rb");
+  bool read = fp != NULL && fread(&s, sizeof(save_t), 1, fp) == 1;
+  if(fp != NULL){ fclose(fp); }
+
+  const node_t *n = NULL;
+  if(!read){ printf("WARNING: No save in %s\n", fn); }
+  else if(s.magic != SAVE_MAGIC || s.version != SAVE_VERSION || s.tagset_words != TAGSET_WORDS || s.checksum != save_checksum(&s)){
+    printf("WARNING: %s is not a save this build can read.\n", fn);
+  }else if(s.flag_count != WORLD.flag_count || s.node[SAVE_ID_SIZE-1] != '\0' || (n = world_find(s.node)) == NULL){
+    printf("WARNING: %s was saved in a different world.\n", fn);
+    n = NULL;
+  }else{
+    memcpy(p->tags.w, s.tags, sizeof(s.tags));
+    p->cur_node = n;
+  }
+  free(fn);
+  return n;
+}
+
+// Waits for every save handed over to be written.
+void save_finish(void){
+  if(SAVER.thread == NULL){ return; }
+  SDL_LockMutex(SAVER.lock);
+  SAVER.quit = true;
+  SDL_CondSignal(SAVER.wake);
+  SDL_UnlockMutex(SAVER.lock);
+  SDL_WaitThread(SAVER.thread, NULL);
+  SAVER.thread = NULL;
+}
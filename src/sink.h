@@ -0,0 +1,71 @@
+#pragma once
+
+// Where frames go in a headless run, in place of a window. The renderer
+// draws into a plain surface the size of the frame; each frame presented can
+// then be hashed, for comparing runs pixel for pixel, and chosen ones saved
+// as PNG. At the end the sink reports how fast frames were made.
+
+static struct {
+  SDL_Surface *frame;  // what the renderer presents into
+  FILE *hashes;        // gets one line per frame, if set
+  uint32_t *dump;      // numbers of the frames to save as PNG
+  uint32_t frames;     // frames presented so far
+  uint64_t start;      // performance counter when the sink was set up
+} SINK;
+
+// A software renderer that presents into the sink.
+SDL_Renderer *sink_init(int32_t w, int32_t h){
+  SINK.frame = create_surface(w, h);
+  SINK.start = SDL_GetPerformanceCounter();
+  SDL_Renderer *rend = SDL_CreateSoftwareRenderer(SINK.frame);
+  if(rend == NULL){ fprintf(stderr, "ERROR: sink_init: %s\n", SDL_GetError()); }
+  return rend;
+}
+
+bool sink_hash_to(const char *fn){
+  SINK.hashes = strcmp(fn, "-") == 0 ? stdout : fopen(fn, "w");
+  if(SINK.hashes == NULL){ fprintf(stderr, "ERROR: Cannot write %s\n", fn); return false; }
+  return true;
+}
+
+// Takes a comma separated list of frame numbers, counted from 0.
+bool sink_dump_frames(const char *list){
+  const char *p = list;
+  while(*p != '\0'){
+    char *end;
+    unsigned long n = strtoul(p, &end, 10);
+    if(end == p || (*end != ',' && *end != '\0')){ fprintf(stderr, "ERROR: Bad frame list %s\n", list); return false; }
+    arrput(SINK.dump, (uint32_t)n);
+    p = *end == ',' ? end + 1 : end;
+  }
+  return true;
+}
+
+// FNV-1a over the pixels, row by row.
+uint64_t frame_hash(SDL_Surface *frame){
+  uint64_t h = 14695981039346656037ull;
+  for(int32_t y=0; y<frame->h; y++){
+    const uint8_t *p = (const uint8_t *)surface_row(frame, y);
+    for(int32_t i=0; i<frame->w*4; i++){ h = (h ^ p[i]) * 1099511628211ull; }
+  }
+  return h;
+}
+
+// Takes the frame just presented.
+void sink_frame(void){
+  uint32_t n = SINK.frames++;
+  if(SINK.hashes != NULL){ fprintf(SINK.hashes, "%u %016llx\n", n, (unsigned long long)frame_hash(SINK.frame)); }
+  for(ptrdiff_t i=0; i<arrlen(SINK.dump); i++){
+    if(SINK.dump[i] != n){ continue; }
+    char fn[32];
+    snprintf(fn, sizeof(fn), "frame-%06u.png", n);
+    png_write(fn, SINK.frame);
+  }
+}
+
+void sink_finish(void){
+  double seconds = (double)(SDL_GetPerformanceCounter() - SINK.start) / SDL_GetPerformanceFrequency();
+  printf("Headless: %u frames in %.3f s, %.1f frames/s\n", SINK.frames, seconds, seconds > 0 ? SINK.frames / seconds : 0);
+  if(SINK.hashes != NULL && SINK.hashes != stdout){ fclose(SINK.hashes); }
+  SINK.hashes = NULL;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+// Undo. Every move the player makes from one scene to the next is logged as
+// the scene they left and the tag bits the move flipped, which is usually
+// none or the one item picked up. Taking a step back flips those bits again
+// and returns to the scene. Records are four bytes in a ring of UNDO_RECORDS,
+// so memory is fixed, pushing and popping a step cost the same however long
+// the game has run, and once the ring is full the oldest steps are forgotten.
+//
+// Nothing in here touches SDL, like player.h.
+
+#define UNDO_RECORDS 1024 // 4 KB
+
+// Set on every record of a step but its last, for the rare move that flips
+// more than one bit.
+#define UNDO_MORE 0x8000
+_Static_assert(TAGSET_WORDS*64 <= UNDO_MORE, "flags must stay below the UNDO_MORE bit");
+
+typedef struct undo_record_t {
+  tag_t  from; // the scene the step left
+  flag_t flag; // a bit the step flipped, or FLAG_NONE; UNDO_MORE if more follow
+} undo_record_t;
+
+static struct {
+  undo_record_t ring[UNDO_RECORDS];
+  uint32_t top;   // records pushed so far; the newest is at top - 1
+  uint32_t count; // records still in the ring
+} UNDO;
+
+// Once the ring is full, the oldest step is forgotten whole: a step undone
+// with only some of its records would leave the tags half restored.
+static void undo_put(tag_t from, flag_t flag){
+  if(UNDO.count == UNDO_RECORDS){
+    bool more;
+    do{
+      more = UNDO.ring[(UNDO.top - UNDO.count) % UNDO_RECORDS].flag & UNDO_MORE;
+      UNDO.count -= 1;
+    }while(more && UNDO.count > 0);
+  }
+  UNDO.ring[UNDO.top++ % UNDO_RECORDS] = (undo_record_t){ from, flag };
+  UNDO.count += 1;
+}
+
+// Logs a move from the scene from, which changed the tags from before to after.
+void undo_push(const node_t *from, const tagset_t *before, const tagset_t *after){
+  flag_t last = FLAG_NONE;
+  for(size_t w=0; w<TAGSET_WORDS; w++){
+    uint64_t diff = before->w[w] ^ after->w[w];
+    for(flag_t b=0; diff != 0; b++, diff >>= 1){
+      if(!(diff & 1)){ continue; }
+      if(last != FLAG_NONE){ undo_put(node_tag(from), last | UNDO_MORE); }
+      last = (flag_t)(w*64 + b);
+    }
+  }
+  undo_put(node_tag(from), last);
+}
+
+// Takes back the last move: flips its bits in tags and returns the scene it
+// left, or NULL once there is nothing left to undo.
+const node_t *undo_pop(tagset_t *tags){
+  if(UNDO.count == 0){ return NULL; }
+  undo_record_t r;
+  do{
+    r = UNDO.ring[--UNDO.top % UNDO_RECORDS];
+    UNDO.count -= 1;
+    flag_t f = r.flag & ~UNDO_MORE;
+    if(f == FLAG_NONE){ continue; }
+    if(tagset_has(tags, f)){ tagset_del(tags, f); }
+    else{ tagset_add(tags, f); }
+  }while(UNDO.count > 0 && (UNDO.ring[(UNDO.top - 1) % UNDO_RECORDS].flag & UNDO_MORE));
+  return node_at(r.from);
+}
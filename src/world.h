@@ -0,0 +1,245 @@
+#pragma once
+
+// The world tree is compiled from a text description (see tools/worldc.c)
+// into a binary image: a header, a table of node records, a parallel table
+// of scene text, and an arena of interned, NUL-terminated strings. The game
+// maps the image and reads the records in place; nothing is parsed at load.
+// Attaching is not quite constant time, though: each record is bounds
+// checked once, a linear pass over the node table (see world_records_valid).
+//
+// A node's tag is its index in both tables. Tag 0 is the root node, which
+// doubles as "no node" wherever a tag is optional.
+//
+// The node record holds only what is read while resolving options, packed
+// into 32 bytes so two share a cache line. The strings only read once a
+// node becomes the scene live in node_text_t, out of the way.
+//
+// Items and flags are also given a bit number. The player's progress is the
+// set of those bits (tagset_t), and every reveal, lock and rehide condition
+// names a bit rather than a node.
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define MAX_CHILDREN 5
+
+#define WORLD_MAGIC   0x39564457 // "WDV9" read as a little-endian word
+#define WORLD_VERSION 3
+
+typedef uint16_t tag_t;
+#define TAG_NONE 0
+#define MAX_TAGS 65536
+
+// Longest idstr, counting its NUL. Saves store the player's scene by idstr
+// in a field this size, so worldc refuses tags that would not fit.
+#define IDSTR_SIZE 32
+
+typedef uint16_t flag_t;
+#define FLAG_NONE 0 // bit zero is never set, so "no condition" needs no test
+
+// Words in a tagset_t. One word covers 63 items and flags; raise it with
+// -DTAGSET_WORDS=n for bigger worlds.
+#ifndef TAGSET_WORDS
+#define TAGSET_WORDS 1
+#endif
+#define TAGSET_BITS (TAGSET_WORDS*64)
+
+typedef enum{
+  NT_NONE, // A node that is not used for anything
+  NT_HALL, // A physical location with many exits
+  NT_ROOM, // A physical location with many objects
+  NT_PROP, // Something for the player to look at
+  NT_ITEM, // Something for the player to pick up
+  NT_FLAG, // Item that is abstract
+  NT_CASE, // Something that contains items
+  NT_LOCK, // A lock that needs a key
+} node_type_t;
+
+typedef struct world_header_t {
+  uint32_t magic;         // WORLD_MAGIC
+  uint32_t version;       // WORLD_VERSION
+  uint32_t node_count;    // number of records in the node table
+  uint32_t flag_count;    // number of flag bits used, counting bit zero
+  uint32_t node_offset;   // byte offset of the node table
+  uint32_t text_offset;   // byte offset of the text table
+  uint32_t string_offset; // byte offset of the string arena
+  uint32_t string_size;   // size of the string arena in bytes
+} world_header_t;
+
+typedef struct node_t {
+  uint16_t type;                   // node_type_t, determines how the player interacts with it
+  flag_t   flag;                   // bit set when the player takes this item or flag, else FLAG_NONE
+  tag_t    parent;                 // this node's parent
+  tag_t    children[MAX_CHILDREN]; // up to five child nodes, TAG_NONE when empty
+
+  flag_t revealed_by; // If set, node is hidden while this flag is false.
+  flag_t unlocked_by; // If set, node is locked while this flag is false.
+  flag_t rehidden_by; // If set, node is hidden while this flag is true.
+  // rehidden overrides revealed
+  uint16_t spare;     // keeps the offsets aligned, always zero
+
+  // Offsets into the string arena.
+  uint32_t idstr;  // the unique id of this node (like 'ODV9-B1-C')
+  uint32_t asopt;  // node's label as option, constructed from label based on type
+} node_t;
+
+typedef struct node_text_t {
+  // Offsets into the string arena.
+  uint32_t title;  // title at the top of a scene view (like 'Storage Room')
+  uint32_t label;  // the name of the node (like "cutting torch" or "storage room")
+  uint32_t prose;  // full text shown in a scene view (like 'The room is lined with shelves... ')
+  uint32_t bgimg;  // image file to display in a scene view (like 'storage-room.png')
+} node_text_t;
+
+_Static_assert(sizeof(node_t) == 32, "node_t should stay two to a cache line");
+
+typedef struct world_t {
+  const uint8_t *data;     // the whole image, mapped or read into memory
+  size_t size;
+  const node_t *nodes;
+  const node_text_t *texts;
+  uint32_t node_count;
+  uint32_t flag_count;
+  const char *strings;
+  uint32_t string_size;
+} world_t;
+
+static world_t WORLD;
+
+static inline const node_t *node_at(tag_t t){ return &WORLD.nodes[t]; }
+static inline tag_t node_tag(const node_t *n){ return (tag_t)(n - WORLD.nodes); }
+static inline const node_text_t *node_text(const node_t *n){ return &WORLD.texts[n - WORLD.nodes]; }
+static inline const char *world_str(uint32_t offset){ return &WORLD.strings[offset]; }
+
+// Whether every tag, flag and string offset in the node records points
+// inside the image, so nothing read through them can run off its end. This
+// makes attaching O(nodes) rather than O(1); at 48 bytes of records per node
+// checked from memory already mapped, it is noise next to opening the file,
+// and images ship apart from the binary, so they cannot be trusted blindly.
+static int world_records_valid(const world_header_t *hdr, const node_t *nodes, const node_text_t *texts){
+  uint32_t n = hdr->node_count, f = hdr->flag_count, s = hdr->string_size;
+  for(uint32_t i=0; i<n; i++){
+    const node_t *nd = &nodes[i];
+    const node_text_t *t = &texts[i];
+    if(nd->type > NT_LOCK || nd->parent >= n){ return 0; }
+    for(int c=0; c<MAX_CHILDREN; c++){ if(nd->children[c] >= n){ return 0; } }
+    if(nd->flag >= f || nd->revealed_by >= f || nd->unlocked_by >= f || nd->rehidden_by >= f){ return 0; }
+    if(nd->idstr >= s || nd->asopt >= s || t->title >= s || t->label >= s || t->prose >= s || t->bgimg >= s){ return 0; }
+  }
+  return 1;
+}
+
+// Checks the header against the size of the image, and every record against
+// the tables and arena, as an image may be older than or foreign to the build.
+int world_attach(const uint8_t *data, size_t size){
+  const world_header_t *hdr = (const world_header_t *)data;
+  if(size < sizeof(world_header_t) || hdr->magic != WORLD_MAGIC){
+    fprintf(stderr, "ERROR: world_attach: Not a world image.\n");
+    return 0;
+  }
+  if(hdr->version != WORLD_VERSION){
+    fprintf(stderr, "ERROR: world_attach: World image is version %u, expected %u.\n", hdr->version, WORLD_VERSION);
+    return 0;
+  }
+  if(hdr->flag_count > TAGSET_BITS){
+    fprintf(stderr, "ERROR: world_attach: World uses %u flags, build with TAGSET_WORDS=%u or more.\n", hdr->flag_count, (hdr->flag_count + 63)/64);
+    return 0;
+  }
+  if(hdr->node_count == 0 || hdr->node_count > MAX_TAGS ||
+     hdr->node_offset % sizeof(uint32_t) != 0 ||
+     hdr->node_offset + (uint64_t)hdr->node_count*sizeof(node_t) > size ||
+     hdr->text_offset % sizeof(uint32_t) != 0 ||
+     hdr->text_offset + (uint64_t)hdr->node_count*sizeof(node_text_t) > size ||
+     hdr->string_size == 0 ||
+     hdr->string_offset + (uint64_t)hdr->string_size > size ||
+     data[hdr->string_offset + hdr->string_size - 1] != '\0'){
+    fprintf(stderr, "ERROR: world_attach: World image is truncated or damaged.\n");
+    return 0;
+  }
+  if(!world_records_valid(hdr, (const node_t *)(data + hdr->node_offset), (const node_text_t *)(data + hdr->text_offset))){
+    fprintf(stderr, "ERROR: world_attach: World image has records pointing outside it.\n");
+    return 0;
+  }
+
+  WORLD.data = data;
+  WORLD.size = size;
+  WORLD.nodes = (const node_t *)(data + hdr->node_offset);
+  WORLD.texts = (const node_text_t *)(data + hdr->text_offset);
+  WORLD.node_count = hdr->node_count;
+  WORLD.flag_count = hdr->flag_count;
+  WORLD.strings = (const char *)(data + hdr->string_offset);
+  WORLD.string_size = hdr->string_size;
+  return 1;
+}
+
+// Maps a compiled world image into memory and makes it the current world.
+int world_load(const char *fn){
+#ifdef _WIN32
+  FILE *fp = fopen(fn, "rb");
+  if(fp == NULL){ fprintf(stderr, "ERROR: world_load: Cannot open %s\n", fn); return 0; }
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  uint8_t *data = malloc(size > 0 ? size : 1);
+  if(size <= 0 || fread(data, 1, size, fp) != (size_t)size){
+    fprintf(stderr, "ERROR: world_load: Cannot read %s\n", fn);
+    free(data); fclose(fp);
+    return 0;
+  }
+  fclose(fp);
+  if(!world_attach(data, size)){ free(data); return 0; }
+#else
+  int fd = open(fn, O_RDONLY);
+  if(fd < 0){ fprintf(stderr, "ERROR: world_load: Cannot open %s\n", fn); return 0; }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || st.st_size <= 0){
+    fprintf(stderr, "ERROR: world_load: Cannot read %s\n", fn);
+    close(fd);
+    return 0;
+  }
+  void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(data == MAP_FAILED){ fprintf(stderr, "ERROR: world_load: Cannot map %s\n", fn); return 0; }
+  if(!world_attach(data, st.st_size)){ munmap(data, st.st_size); return 0; }
+#endif
+  return 1;
+}
+
+// Finds a node by its idstr (like 'MAIN-MENU'). Linear, meant for startup.
+const node_t *world_find(const char *idstr){
+  for(uint32_t i=0; i<WORLD.node_count; i++){
+    if(strcmp(world_str(WORLD.nodes[i].idstr), idstr) == 0){ return &WORLD.nodes[i]; }
+  }
+  return NULL;
+}
+
+////////////////////////// TAG SETS //////////////////////////
+
+// Everything the player has picked up or done, one bit per item and flag.
+// Plain data: copy it to snapshot, assign it back to restore.
+typedef struct tagset_t {
+  uint64_t w[TAGSET_WORDS];
+} tagset_t;
+
+static inline int  tagset_has(const tagset_t *s, flag_t f){ return (s->w[f >> 6] >> (f & 63)) & 1; }
+static inline void tagset_add(tagset_t *s, flag_t f){ s->w[f >> 6] |=  (uint64_t)1 << (f & 63); }
+static inline void tagset_del(tagset_t *s, flag_t f){ s->w[f >> 6] &= ~((uint64_t)1 << (f & 63)); }
+
+static inline int tagset_equal(const tagset_t *a, const tagset_t *b){
+  uint64_t diff = 0;
+  for(size_t i=0; i<TAGSET_WORDS; i++){ diff |= a->w[i] ^ b->w[i]; }
+  return diff == 0;
+}
+
+static inline uint64_t tagset_hash(const tagset_t *s){
+  uint64_t h = 0x9E3779B97F4A7C15ULL;
+  for(size_t i=0; i<TAGSET_WORDS; i++){
+    h = (h ^ s->w[i]) * 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 31;
+  }
+  return h;
+}
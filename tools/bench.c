@@ -0,0 +1,181 @@
+// bench: times the engine's hot paths headless and writes the results as JSON,
+// so runs before and after an engine change can be compared.
+//
+// usage: bench [-w WARMUP] [-r REPS] [-o FILE] [WORLD]
+//
+// Each benchmark calls its function a fixed number of times per sample. It
+// takes WARMUP samples that are thrown away, then REPS that are kept, and
+// reports the min, median and p95 of the kept samples in nanoseconds per
+// call. WORLD defaults to the game's own world file, so run it from bin/.
+
+// The game is one translation unit; the bench takes all of it but its main.
+#define main odv9_main
+#include "odv9.c"
+#undef main
+
+#define DEFAULT_WARMUP 20
+#define DEFAULT_REPS 200
+
+typedef struct bench_t {
+  const char *name;
+  void (*fn)(uint32_t n); // runs the benchmarked call n times
+  uint32_t calls;         // calls per sample
+} bench_t;
+
+static canvas_t bench_canvas;
+static canvas_t bench_scaled;  // a software canvas presented at 3x
+static SDL_Surface *bench_surface;
+static const char *longest_prose = "";
+static scene_t menu_scene; // the scene every frame is composed from
+
+static void bench_draw_string(uint32_t n){
+  for(uint32_t i=0; i<n; i++){ font_draw_string(font_opt_normal, "3) Examine the terminal on the far wall.", 22, 158, bench_surface); }
+}
+
+static void bench_get_width(uint32_t n){
+  uint32_t w = 0;
+  for(uint32_t i=0; i<n; i++){ w += font_get_width(font_prose, longest_prose); }
+  if(w == 1){ printf("%u\n", w); } // Keeps the calls from being optimized out
+}
+
+static void bench_wrap_string(uint32_t n){
+  for(uint32_t i=0; i<n; i++){ font_wrap_string(font_prose, longest_prose, PROSE_X, PROSE_Y, PROSE_W, bench_surface); }
+}
+
+// Every node in the world entered from a clean slate, one after another.
+static void bench_update_node(uint32_t n){
+  for(uint32_t i=0; i<n; i++){
+    tagset_t none = { 0 };
+    player.tags = none;
+    NEXT_NODE = node_at(i % WORLD.node_count);
+    player_update_node();
+  }
+}
+
+// A flood of key presses and releases queued up before each read.
+#define FLOOD_EVENTS 64
+static void bench_controller_read(uint32_t n){
+  static const uint32_t keys[] = { SDL_SCANCODE_UP, SDL_SCANCODE_DOWN, SDL_SCANCODE_RETURN, SDL_SCANCODE_Z };
+  for(uint32_t i=0; i<n; i++){
+    SDL_Event e;
+    memset(&e, 0, sizeof(e));
+    for(uint32_t k=0; k<FLOOD_EVENTS; k++){
+      e.type = (k & 1) ? SDL_KEYUP : SDL_KEYDOWN;
+      e.key.keysym.scancode = keys[(k / 2) % 4];
+      SDL_PushEvent(&e);
+    }
+    controller_read();
+  }
+}
+
+static void bench_compose_frame(uint32_t n){
+  CURRENT_SCENE = menu_scene;
+  for(uint32_t i=0; i<n; i++){
+    canvas_begin(&bench_canvas, 0, 240);
+    compose_frame(&bench_canvas);
+    canvas_end(&bench_canvas);
+  }
+}
+
+static void bench_compose_fade(uint32_t n){
+  TRANS_ALPHA = 128;
+  bench_compose_frame(n);
+  TRANS_ALPHA = 0;
+}
+
+// The software renderer's present path: the whole frame replicated to 3x.
+static void bench_scale_frame(uint32_t n){
+  for(uint32_t i=0; i<n; i++){ canvas_scale_rows(&bench_scaled, 0, bench_scaled.h); }
+}
+
+static const bench_t benches[] = {
+  { "font_draw_string",   bench_draw_string,     1000 },
+  { "font_get_width",     bench_get_width,       1000 },
+  { "font_wrap_string",   bench_wrap_string,     100 },
+  { "player_update_node", bench_update_node,     1000 },
+  { "controller_read",    bench_controller_read, 10 },
+  { "compose_frame",      bench_compose_frame,   10 },
+  { "compose_frame_fade", bench_compose_fade,    10 },
+  { "scale_frame",        bench_scale_frame,     10 },
+};
+
+static int cmp_double(const void *a, const void *b){
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static void bench_usage(void){
+  fprintf(stderr, "usage: bench [-w WARMUP] [-r REPS] [-o FILE] [WORLD]\n");
+  exit(2);
+}
+
+int main(int argc, char *argv[]){
+  uint32_t warmup = DEFAULT_WARMUP;
+  uint32_t reps = DEFAULT_REPS;
+  const char *out_fn = NULL;
+  const char *world_fn = WORLD_FILE;
+
+  for(int i=1; i<argc; i++){
+    if(strcmp(argv[i], "-w") == 0 && i+1 < argc){ warmup = strtoul(argv[++i], NULL, 10); }
+    else if(strcmp(argv[i], "-r") == 0 && i+1 < argc){ reps = strtoul(argv[++i], NULL, 10); }
+    else if(strcmp(argv[i], "-o") == 0 && i+1 < argc){ out_fn = argv[++i]; }
+    else if(argv[i][0] == '-'){ bench_usage(); }
+    else{ world_fn = argv[i]; }
+  }
+  if(reps == 0){ bench_usage(); }
+
+  SDL_Init(SDL_INIT_EVENTS);
+  pixel_init();
+  ready_static_images();
+  ready_frame_style();
+  if(!world_load(world_fn)){ return 1; }
+
+  // Software rendering into a plain surface: no window, no GPU.
+  SDL_Renderer *rend = SDL_CreateSoftwareRenderer(create_surface(VIRTUAL_SCREEN_SIZE));
+  canvas_init(&bench_canvas, rend, VIRTUAL_SCREEN_SIZE, CANVAS_SOFTWARE);
+  bench_surface = create_surface(VIRTUAL_SCREEN_SIZE);
+  SDL_Renderer *rend_3x = SDL_CreateSoftwareRenderer(create_surface(VIRTUAL_SCREEN_W * 3, VIRTUAL_SCREEN_H * 3));
+  canvas_init(&bench_scaled, rend_3x, VIRTUAL_SCREEN_SIZE, CANVAS_SOFTWARE);
+
+  for(size_t i=0; i<WORLD.node_count; i++){
+    const char *prose = world_str(node_text(node_at(i))->prose);
+    if(strlen(prose) > strlen(longest_prose)){ longest_prose = prose; }
+  }
+
+  NEXT_NODE = world_find("MAIN-MENU");
+  while(NEXT_NODE != NULL){ player_update_node(); }
+  CURRENT_SCENE.prose_shown = CURRENT_SCENE.prose_len; // Typed out in full
+  menu_scene = CURRENT_SCENE;
+
+  FILE *out = stdout;
+  if(out_fn != NULL && (out = fopen(out_fn, "w")) == NULL){
+    fprintf(stderr, "ERROR: Cannot write %s\n", out_fn);
+    return 1;
+  }
+
+  double *samples = malloc(reps * sizeof(double));
+  double ns = 1e9 / SDL_GetPerformanceFrequency();
+  size_t count = sizeof(benches) / sizeof(benches[0]);
+
+  fprintf(out, "{\"pixel_path\":\"%s\",\"warmup\":%u,\"reps\":%u,\"benchmarks\":[\n", PIXEL_PATH, warmup, reps);
+  for(size_t b=0; b<count; b++){
+    const bench_t *bn = &benches[b];
+    for(uint32_t r=0; r<warmup; r++){ bn->fn(bn->calls); }
+    for(uint32_t r=0; r<reps; r++){
+      uint64_t start = SDL_GetPerformanceCounter();
+      bn->fn(bn->calls);
+      samples[r] = (SDL_GetPerformanceCounter() - start) * ns / bn->calls;
+    }
+    qsort(samples, reps, sizeof(double), cmp_double);
+    double min = samples[0], median = samples[reps / 2], p95 = samples[(reps - 1) * 95 / 100];
+    fprintf(out, "{\"name\":\"%s\",\"unit\":\"ns\",\"calls\":%u,\"min\":%.1f,\"median\":%.1f,\"p95\":%.1f}%s\n",
+      bn->name, bn->calls, min, median, p95, b+1 < count ? "," : "");
+    fprintf(stderr, "%-20s %12.1f ns median %12.1f ns p95\n", bn->name, median, p95);
+  }
+  fprintf(out, "]}\n");
+
+  if(out != stdout){ fclose(out); }
+  free(samples);
+  SDL_Quit();
+  return 0;
+}
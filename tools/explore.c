@@ -0,0 +1,345 @@
+// explore: walks every state a player can reach in a compiled world, without
+// a window, and reports the content bugs hand-playing tends to miss.
+//
+// usage: explore [-j THREADS] [-n MAX_STATES] [-g GOAL] bin/odv9.wld
+//
+// A state is the scene in front of the player plus the items and flags they
+// hold. From each state every unlocked option is taken, using the same rules
+// as the game (src/player.h), breadth first and one level at a time. Each
+// level is split across THREADS workers which share a lock-free visited set.
+//
+// Reported afterwards:
+//   unreachable  nodes the player can never enter
+//   dead end     states with no option that can be taken
+//   softlock     states from which GOAL can no longer be reached
+//   path         the shortest run of choices from the start to GOAL
+//
+// The exit status is non-zero when GOAL is unreachable or any dead end or
+// softlock exists, so a content build can fail on it.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "world.h"
+#include "player.h"
+
+#define DEFAULT_MAX_STATES (1u << 22)
+#define CHUNK_SIZE 256       // states a worker claims from the level at a time
+#define MAX_REPORTED 10      // examples printed per kind of problem
+
+typedef struct state_t {
+  tagset_t tags;   // items and flags the player holds
+  uint32_t parent; // state this one was first reached from
+  tag_t    node;   // the scene in front of the player
+  uint8_t  choice; // number of the option taken in the parent
+  uint8_t  dead;   // lost the race to insert an equal state, ignore it
+} state_t;
+
+typedef struct edge_t {
+  uint32_t from;
+  uint32_t to;
+} edge_t;
+
+typedef struct worker_t {
+  pthread_t thread;
+  edge_t *edges; // every transition this worker has taken
+  size_t edge_count;
+  size_t edge_cap;
+} worker_t;
+
+static state_t *states;
+static uint32_t max_states;
+static _Atomic uint32_t state_count;
+static atomic_bool overflow;
+
+// Open addressing over state indices, plus one so that zero means empty.
+static _Atomic uint32_t *slots;
+static uint32_t slot_mask;
+
+static _Atomic uint8_t *entered; // per node, set once the player has stepped onto it
+
+static const node_t *start_node;
+static const node_t *exit_node;
+static const node_t *goal_node;
+
+static uint32_t level_lo, level_hi;
+static _Atomic uint32_t level_next;
+
+////////////////////////// VISITED SET //////////////////////////
+
+static uint64_t state_hash(const tagset_t *tags, tag_t node){
+  uint64_t h = tagset_hash(tags) ^ ((uint64_t)node * 0x9E3779B97F4A7C15ULL);
+  return h ^ (h >> 29);
+}
+
+// Finds the state for (node, tags), adding it if it is new. Returns its
+// index, or UINT32_MAX once the state table is full.
+static uint32_t state_insert(const tagset_t *tags, tag_t node, uint32_t parent, uint8_t choice){
+  uint32_t mine = UINT32_MAX;
+
+  for(uint32_t i = state_hash(tags, node) & slot_mask; ; i = (i+1) & slot_mask){
+    uint32_t cur = atomic_load_explicit(&slots[i], memory_order_acquire);
+    if(cur == 0){
+      // Write the state out before publishing it, so readers never see it half done.
+      if(mine == UINT32_MAX){
+        mine = atomic_fetch_add_explicit(&state_count, 1, memory_order_relaxed);
+        if(mine >= max_states){ atomic_store(&overflow, true); return UINT32_MAX; }
+        states[mine] = (state_t){ *tags, parent, node, choice, 0 };
+      }
+      if(atomic_compare_exchange_strong_explicit(&slots[i], &cur, mine+1, memory_order_acq_rel, memory_order_acquire)){
+        return mine;
+      }
+      // Someone else took the slot; cur now holds what they put there.
+    }
+    const state_t *s = &states[cur-1];
+    if(s->node == node && tagset_equal(&s->tags, tags)){
+      if(mine != UINT32_MAX){ states[mine].dead = 1; }
+      return cur-1;
+    }
+  }
+}
+
+/////////////////////////// EXPANSION ///////////////////////////
+
+static void edge_add(worker_t *w, uint32_t from, uint32_t to){
+  if(w->edge_count == w->edge_cap){
+    w->edge_cap = w->edge_cap ? w->edge_cap*2 : 4096;
+    w->edges = realloc(w->edges, w->edge_cap*sizeof(edge_t));
+  }
+  w->edges[w->edge_count++] = (edge_t){ from, to };
+}
+
+// Follows the player from one choice to the next scene they stop on, as the
+// game does across several ticks.
+static const node_t *settle(player_t *p, const node_t *next){
+  const node_t *scene = next;
+  for(uint32_t steps=0; next != NULL && steps <= WORLD.node_count; steps++){
+    atomic_store_explicit(&entered[node_tag(next)], 1, memory_order_relaxed);
+    scene = next;
+    next = player_enter(p, next);
+  }
+  if(next != NULL){
+    fprintf(stderr, "ERROR: explore: %s never settles on a scene.\n", world_str(scene->idstr));
+    exit(1);
+  }
+  return scene;
+}
+
+static void expand(worker_t *w, uint32_t from){
+  const state_t *s = &states[from];
+  const node_t *n = node_at(s->node);
+  if(n == exit_node){ return; }
+
+  choice_t choices[MAX_OPTIONS];
+  node_choices(n, &s->tags, choices);
+  for(size_t i=0; i<MAX_OPTIONS; i++){
+    if(choices[i].target == NULL){ continue; }
+    player_t p = { n, s->tags };
+    const node_t *scene = settle(&p, choices[i].target);
+    uint32_t to = state_insert(&p.tags, node_tag(scene), from, choices[i].number);
+    if(to == UINT32_MAX){ return; }
+    edge_add(w, from, to);
+  }
+}
+
+static void *worker_run(void *arg){
+  worker_t *w = arg;
+  for(;;){
+    uint32_t lo = atomic_fetch_add_explicit(&level_next, CHUNK_SIZE, memory_order_relaxed);
+    if(lo >= level_hi || atomic_load_explicit(&overflow, memory_order_relaxed)){ break; }
+    uint32_t hi = lo + CHUNK_SIZE < level_hi ? lo + CHUNK_SIZE : level_hi;
+    for(uint32_t i=lo; i<hi; i++){
+      if(!states[i].dead){ expand(w, i); }
+    }
+  }
+  return NULL;
+}
+
+//////////////////////////// REPORTS ////////////////////////////
+
+static const node_t **flag_nodes; // the item or flag node that sets each bit
+
+static void print_state(const char *prefix, uint32_t idx){
+  const state_t *s = &states[idx];
+  printf("%s%s holding", prefix, world_str(node_at(s->node)->idstr));
+  bool any = false;
+  for(flag_t f=1; f<WORLD.flag_count; f++){
+    if(tagset_has(&s->tags, f)){ printf(" %s", world_str(flag_nodes[f]->idstr)); any = true; }
+  }
+  printf("%s\n", any ? "" : " nothing");
+}
+
+static void print_path(uint32_t idx){
+  uint32_t *path = NULL;
+  size_t len = 0;
+  for(uint32_t i=idx; i!=0; i=states[i].parent){
+    path = realloc(path, (len+1)*sizeof(uint32_t));
+    path[len++] = i;
+  }
+  printf("  %s\n", world_str(node_at(states[0].node)->idstr));
+  for(size_t i=len; i>0; i--){
+    const state_t *s = &states[path[i-1]];
+    printf("  %i) -> %s\n", s->choice, world_str(node_at(s->node)->idstr));
+  }
+  free(path);
+}
+
+static double seconds_since(const struct timespec *t0){
+  struct timespec t1;
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  return (t1.tv_sec - t0->tv_sec) + (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+static void usage(const char *prog){
+  fprintf(stderr, "usage: %s [-j THREADS] [-n MAX_STATES] [-g GOAL] WORLD.wld\n", prog);
+  exit(1);
+}
+
+int main(int argc, char *argv[]){
+  long threads = sysconf(_SC_NPROCESSORS_ONLN);
+  long max = DEFAULT_MAX_STATES;
+  const char *goal = "ODV9-ESCAPE-THE-OUTPOST";
+  const char *fn = NULL;
+
+  for(int i=1; i<argc; i++){
+    if(strcmp(argv[i], "-j") == 0 && i+1 < argc){ threads = atol(argv[++i]); }
+    else if(strcmp(argv[i], "-n") == 0 && i+1 < argc){ max = atol(argv[++i]); }
+    else if(strcmp(argv[i], "-g") == 0 && i+1 < argc){ goal = argv[++i]; }
+    else if(argv[i][0] != '-' && fn == NULL){ fn = argv[i]; }
+    else{ usage(argv[0]); }
+  }
+  if(fn == NULL || threads < 1 || max < 1 || max >= UINT32_MAX/2){ usage(argv[0]); }
+
+  if(!world_load(fn)){ return 1; }
+  start_node = world_find("MAIN-MENU");
+  exit_node = world_find("GAME-EXIT");
+  goal_node = world_find(goal);
+  if(start_node == NULL || exit_node == NULL){ fprintf(stderr, "ERROR: %s lacks a MAIN_MENU or GAME_EXIT node.\n", fn); return 1; }
+  if(goal_node == NULL){ fprintf(stderr, "ERROR: No node named %s.\n", goal); return 1; }
+  if(goal_node->type == NT_ITEM || goal_node->type == NT_FLAG){
+    fprintf(stderr, "ERROR: %s is picked up, never shown; pick a scene as the goal.\n", goal);
+    return 1;
+  }
+
+  max_states = max;
+  uint32_t slot_count = 1;
+  while(slot_count < max_states*2){ slot_count *= 2; }
+  slot_mask = slot_count - 1;
+  states = malloc((size_t)max_states*sizeof(state_t));
+  slots = calloc(slot_count, sizeof(*slots));
+  entered = calloc(WORLD.node_count, sizeof(*entered));
+  flag_nodes = calloc(WORLD.flag_count, sizeof(*flag_nodes));
+  worker_t *workers = calloc(threads, sizeof(worker_t));
+  if(states == NULL || slots == NULL){ fprintf(stderr, "ERROR: Out of memory for %u states.\n", max_states); return 1; }
+  for(uint32_t i=0; i<WORLD.node_count; i++){
+    if(node_at(i)->flag != FLAG_NONE){ flag_nodes[node_at(i)->flag] = node_at(i); }
+  }
+
+  struct timespec t0;
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+
+  // The game starts by stepping onto the main menu with nothing in hand.
+  player_t p = { NULL, {{0}} };
+  state_insert(&p.tags, node_tag(settle(&p, start_node)), 0, 0);
+
+  uint32_t levels = 0;
+  level_lo = 0;
+  level_hi = atomic_load(&state_count);
+  while(level_lo < level_hi && !atomic_load(&overflow)){
+    atomic_store(&level_next, level_lo);
+    long n = (level_hi - level_lo + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    n = n < threads ? n : threads;
+    for(long i=1; i<n; i++){ pthread_create(&workers[i].thread, NULL, worker_run, &workers[i]); }
+    worker_run(&workers[0]);
+    for(long i=1; i<n; i++){ pthread_join(workers[i].thread, NULL); }
+    level_lo = level_hi;
+    level_hi = atomic_load(&state_count);
+    levels++;
+  }
+  if(atomic_load(&overflow)){
+    fprintf(stderr, "ERROR: explore: More than %u states; raise the limit with -n.\n", max_states);
+    return 1;
+  }
+  uint32_t total = level_hi;
+  double explore_time = seconds_since(&t0);
+
+  // Reverse the transitions into one array per state, then walk back from
+  // every goal state. Whatever that walk never reaches has lost the game.
+  uint32_t *rev_start = calloc(total+1, sizeof(uint32_t));
+  size_t edge_total = 0;
+  for(long t=0; t<threads; t++){
+    edge_total += workers[t].edge_count;
+    for(size_t e=0; e<workers[t].edge_count; e++){ rev_start[workers[t].edges[e].to + 1]++; }
+  }
+  for(uint32_t i=0; i<total; i++){ rev_start[i+1] += rev_start[i]; }
+  uint32_t *rev = malloc((edge_total ? edge_total : 1)*sizeof(uint32_t));
+  uint32_t *fill = malloc((total ? total : 1)*sizeof(uint32_t));
+  memcpy(fill, rev_start, total*sizeof(uint32_t));
+  for(long t=0; t<threads; t++){
+    for(size_t e=0; e<workers[t].edge_count; e++){ rev[fill[workers[t].edges[e].to]++] = workers[t].edges[e].from; }
+  }
+
+  uint8_t *wins = calloc(total, 1);
+  uint32_t *queue = fill; // reused: done with it
+  uint32_t qh = 0, qt = 0;
+  uint32_t first_goal = UINT32_MAX;
+  for(uint32_t i=0; i<total; i++){
+    if(!states[i].dead && states[i].node == node_tag(goal_node)){
+      wins[i] = 1; queue[qt++] = i;
+      if(first_goal == UINT32_MAX){ first_goal = i; }
+    }
+  }
+  while(qh < qt){
+    uint32_t i = queue[qh++];
+    for(uint32_t e=rev_start[i]; e<rev_start[i+1]; e++){
+      if(!wins[rev[e]]){ wins[rev[e]] = 1; queue[qt++] = rev[e]; }
+    }
+  }
+
+  uint32_t live = 0, dead_ends = 0, softlocks = 0, unreachable = 0;
+  for(uint32_t i=0; i<total; i++){
+    if(states[i].dead){ continue; }
+    live++;
+    const node_t *n = node_at(states[i].node);
+    if(n == exit_node){ continue; }
+
+    choice_t choices[MAX_OPTIONS];
+    node_choices(n, &states[i].tags, choices);
+    bool any = false;
+    for(size_t c=0; c<MAX_OPTIONS; c++){ any |= (choices[c].target != NULL); }
+    if(!any){
+      if(dead_ends++ < MAX_REPORTED){ print_state("dead end: ", i); }
+    }else if(!wins[i]){
+      if(softlocks++ < MAX_REPORTED){ print_state("softlock: ", i); }
+    }
+  }
+  for(uint32_t i=1; i<WORLD.node_count; i++){
+    if(!entered[i] && node_at(i)->type != NT_NONE){
+      printf("unreachable: %s\n", world_str(node_at(i)->idstr));
+      unreachable++;
+    }
+  }
+
+  printf("explore: %u states, %zu transitions, %u levels in %.3fs on %ld thread%s\n",
+         live, edge_total, levels, explore_time, threads, threads == 1 ? "" : "s");
+  printf("explore: %u unreachable nodes, %u dead ends, %u softlocks\n", unreachable, dead_ends, softlocks);
+  if(first_goal == UINT32_MAX){
+    printf("explore: %s cannot be reached\n", goal);
+    return 1;
+  }
+  uint32_t steps = 0;
+  for(uint32_t i=first_goal; i!=0; i=states[i].parent){ steps++; }
+  printf("explore: shortest path to %s takes %u choices:\n", goal, steps);
+  print_path(first_goal);
+
+  return (dead_ends > 0 || softlocks > 0) ? 1 : 0;
+}
@@ -0,0 +1,47 @@
+#!/usr/bin/env bash
+#
+# headless_check.sh: runs the game headless on the real world, and on a copy
+# whose main menu has a background image, then checks the frame hashes. The
+# background must change them, and runs must hash the same at any speed.
+#
+# usage: tools/headless_check.sh GAME WORLDC
+#
+
+set -euo pipefail
+
+if [[ $# -ne 2 ]]; then
+    printf 'usage: %s GAME WORLDC\n' "${0##*/}" >&2
+    exit 1
+fi
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+game=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+worldc=$(cd "$(dirname "$2")" && pwd)/$(basename "$2")
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+
+# Two seconds on the main menu: an ILG1 header, then one run of no buttons for 200 ticks.
+printf 'ILG1\001\000\000\000\000\000\000\000\310\000\000\000' > "$dir/idle.ilg"
+
+mkdir "$dir/plain" "$dir/bgimg"
+"$worldc" "$root/world/odv9.world" "$dir/plain/odv9.wld" >/dev/null
+sed 's/^desc "Outpost DV9 - Main Menu" ""/desc "Outpost DV9 - Main Menu" "bg.png"/' \
+    "$root/world/odv9.world" > "$dir/bgimg.world"
+"$worldc" "$dir/bgimg.world" "$dir/bgimg/odv9.wld" >/dev/null
+# Any image but the frame, which screen_clear already shows behind every scene.
+cp "$root/res/cursor-arrow.png" "$dir/bgimg/bg.png"
+
+run() { (cd "$dir/$1" && "$game" --headless --replay ../idle.ilg $3 --hash "$2" >/dev/null); }
+run plain plain.txt --fast
+run bgimg fast.txt --fast
+run bgimg slow.txt ""
+
+fail=0
+if cmp -s "$dir/plain/plain.txt" "$dir/bgimg/fast.txt"; then
+    echo "headless_check: the main menu's background never appeared" >&2; fail=1
+fi
+if ! cmp -s "$dir/bgimg/fast.txt" "$dir/bgimg/slow.txt"; then
+    echo "headless_check: --fast and real-time runs hashed differently" >&2; fail=1
+fi
+[[ $fail == 0 ]] && echo "headless_check: ok ($(wc -l < "$dir/bgimg/fast.txt") frames)"
+exit $fail
@@ -0,0 +1,23 @@
+// pixeltest: checks that every pixel kernel this CPU can run gives the same
+// bits as the scalar one. Exits non-zero on any mismatch, for make test.
+//
+// usage: pixeltest
+
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <SDL.h>
+
+#define DEBUG // pixel_self_test is only built into debug builds of the game
+#include "pixel.h"
+
+int main(int argc, char *argv[]){
+  (void)(argc); (void)(argv); // Suppress unused warning
+  pixel_init();
+  bool pass = pixel_self_test();
+  printf("pixeltest: %s kernels %s\n", PIXEL_PATH, pass ? "match" : "DIFFER");
+  return pass ? 0 : 1;
+}
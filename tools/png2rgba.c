@@ -0,0 +1,67 @@
+// png2rgba: decodes a PNG at build time into a C header holding the image as
+// RGBA8888 pixels, ready to be wrapped in an SDL_Surface without conversion.
+//
+// usage: png2rgba res/font-small-8.png src/font_small_8_rgba.h
+//
+// The symbol names are taken from the file name with dashes turned into
+// underscores: font_small_8_rgba, font_small_8_rgba_w and font_small_8_rgba_h.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_PNG
+#include "stb_image.h"
+
+#define WORDS_PER_LINE 8
+
+int main(int argc, char *argv[]){
+  if(argc != 3){
+    fprintf(stderr, "usage: %s INPUT.png OUTPUT.h\n", argv[0]);
+    return 1;
+  }
+
+  int32_t w, h, of;
+  unsigned char *data = stbi_load(argv[1], &w, &h, &of, 4);
+  if(data == NULL){
+    fprintf(stderr, "ERROR: Image failed to load: %s (%s)\n", argv[1], stbi_failure_reason());
+    return 1;
+  }
+
+  // Symbol name: basename without extension, dashes to underscores.
+  char name[256];
+  const char *base = strrchr(argv[1], '/');
+  base = (base == NULL) ? argv[1] : base + 1;
+  size_t n = 0;
+  for(; base[n] != '\0' && base[n] != '.' && n < sizeof(name)-1; n++){
+    name[n] = isalnum((unsigned char)base[n]) ? base[n] : '_';
+  }
+  name[n] = '\0';
+
+  FILE *out = fopen(argv[2], "w");
+  if(out == NULL){
+    fprintf(stderr, "ERROR: Cannot write: %s\n", argv[2]);
+    stbi_image_free(data);
+    return 1;
+  }
+
+  fprintf(out, "// Generated from %s by tools/png2rgba.c. Do not edit; run 'make assets'.\n", base);
+  fprintf(out, "#pragma once\n\n");
+  fprintf(out, "const int32_t %s_rgba_w = %d;\n", name, w);
+  fprintf(out, "const int32_t %s_rgba_h = %d;\n", name, h);
+  fprintf(out, "uint32_t %s_rgba[] = {", name);
+
+  for(int32_t i=0; i<w*h; i++){
+    const unsigned char *p = &data[i*4];
+    uint32_t rgba = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    fprintf(out, "%s0x%08x%s", (i % WORDS_PER_LINE == 0) ? "\n  " : " ", rgba, (i < w*h-1) ? "," : "");
+  }
+
+  fprintf(out, "\n};\n");
+  fclose(out);
+  stbi_image_free(data);
+  return 0;
+}
@@ -0,0 +1,481 @@
+// worldc: compiles a text world description into the binary world image
+// the game maps at startup (see src/world.h for the image layout).
+//
+// usage: worldc world/odv9.world bin/odv9.wld
+//
+// A world file is a list of directives that build the tree one node at a
+// time, in the same order the nodes used to be built in code:
+//
+//   select TAG                       make TAG the current node
+//   init "label" TYPE                name and type the current node
+//   desc "title" "bgimg" "prose"...  scene text; adjacent prose strings join
+//   asopt "text"                     custom option text for the current node
+//   link TAG TAG TAG TAG TAG         set all five children, '-' for none
+//   child_of TAG                     add the current node to TAG's first free slot
+//   parent TAG                       override the current node's parent
+//   revealed_by TAG / unlocked_by TAG / rehidden_by TAG
+//
+// TYPE is one of NONE HALL ROOM PROP ITEM FLAG CASE LOCK. Strings take the C
+// escapes \n \t \" \\ and \'. Everything after a '#' is a comment. Tags are
+// numbered in order of first appearance, with TAG_NONE always first.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "world.h"
+
+// The game copies scene text into buffers of these sizes; longer strings
+// are kept whole in the arena but warned about, as they will be cut short.
+#define STR_SIZE_S 64
+#define STR_SIZE_M 128
+#define STR_SIZE_L 1024
+
+#define MAX_ARGS 64
+
+// Nodes are built straight into their output records; every string is
+// interned into the arena as soon as its directive is read.
+typedef struct build_node_t {
+  char name[STR_SIZE_S];   // the tag as written in the world file (like 'ODV9_B1_C')
+  int  init_line;          // line of the node's init directive, zero if it has none
+  int  first_line;         // line where the tag first appeared
+  bool custom_asopt;       // given an asopt, which may be "" and so share offset zero
+  // Conditions name nodes while parsing, as they may not be defined yet.
+  // They become flag bits once the whole file is read.
+  tag_t revealed_by;
+  tag_t unlocked_by;
+  tag_t rehidden_by;
+} build_node_t;
+
+static build_node_t *nodes;
+static node_t *out_nodes;
+static node_text_t *out_texts;
+static uint32_t node_count = 0;
+
+static const char *src_fn;
+static int src_line;
+
+static void fail(const char *fmt, ...){
+  va_list ap;
+  va_start(ap, fmt);
+  fprintf(stderr, "%s:%d: error: ", src_fn, src_line);
+  vfprintf(stderr, fmt, ap);
+  fprintf(stderr, "\n");
+  va_end(ap);
+  exit(1);
+}
+
+static void warn(const char *fmt, ...){
+  va_list ap;
+  va_start(ap, fmt);
+  fprintf(stderr, "%s:%d: warning: ", src_fn, src_line);
+  vfprintf(stderr, fmt, ap);
+  fprintf(stderr, "\n");
+  va_end(ap);
+}
+
+///////////////////////////// TAGS /////////////////////////////
+
+static tag_t tag_lookup(const char *name){
+  if(strcmp(name, "-") == 0){ return TAG_NONE; }
+  for(uint32_t i=0; i<node_count; i++){
+    if(strcmp(nodes[i].name, name) == 0){ return i; }
+  }
+  if(node_count == MAX_TAGS){ fail("too many tags"); }
+  if(strlen(name) >= STR_SIZE_S){ fail("tag name too long: %s", name); }
+  for(const char *c=name; *c!='\0'; c++){
+    if(!isalnum((unsigned char)*c) && *c != '_'){ fail("bad tag name: %s", name); }
+  }
+  build_node_t *n = &nodes[node_count];
+  snprintf(n->name, STR_SIZE_S, "%s", name);
+  n->first_line = src_line;
+  return node_count++;
+}
+
+static void format_idstr(char *dst, const char *src){ for(size_t i=0;i<STR_SIZE_S;i++){ if(src[i]=='\0'){ dst[i]='\0'; break; }else if(src[i]=='_' ){ dst[i]='-'; }else{ dst[i]=toupper(src[i]); } } }
+
+////////////////////////// STRING POOL //////////////////////////
+
+static char *pool = NULL;
+static uint32_t pool_size = 0;
+static uint32_t pool_cap = 0;
+static uint32_t *pool_slots = NULL; // offset+1 of each interned string, zero if empty
+static uint32_t pool_slot_count = 0; // a power of two, kept at least twice pool_strings
+static uint32_t pool_strings = 0;
+
+static uint32_t pool_hash(const char *s){
+  uint32_t h = 2166136261u;
+  for(const char *c=s; *c!='\0'; c++){ h = (h ^ (uint8_t)*c) * 16777619u; }
+  return h;
+}
+
+// Doubles the slot table and puts every interned string back in it.
+static void pool_grow(void){
+  uint32_t *old = pool_slots;
+  uint32_t old_count = pool_slot_count;
+  pool_slot_count = old_count ? old_count*2 : 4096;
+  pool_slots = calloc(pool_slot_count, sizeof(uint32_t));
+  for(uint32_t j=0; j<old_count; j++){
+    if(old[j] == 0){ continue; }
+    uint32_t i = pool_hash(&pool[old[j]-1]) & (pool_slot_count-1);
+    while(pool_slots[i] != 0){ i = (i+1) & (pool_slot_count-1); }
+    pool_slots[i] = old[j];
+  }
+  free(old);
+}
+
+// Adds a string to the pool once; identical strings share one offset.
+static uint32_t intern(const char *s){
+  if((pool_strings + 1) * 2 > pool_slot_count){ pool_grow(); }
+  for(uint32_t i=pool_hash(s) & (pool_slot_count-1); ; i=(i+1) & (pool_slot_count-1)){
+    if(pool_slots[i] == 0){
+      uint32_t len = strlen(s) + 1;
+      while(pool_size + len > pool_cap){
+        pool_cap = pool_cap ? pool_cap*2 : 4096;
+        pool = realloc(pool, pool_cap);
+      }
+      memcpy(&pool[pool_size], s, len);
+      pool_slots[i] = pool_size + 1;
+      pool_size += len;
+      pool_strings += 1;
+      return pool_size - len;
+    }
+    if(strcmp(&pool[pool_slots[i]-1], s) == 0){ return pool_slots[i]-1; }
+  }
+}
+
+//////////////////////////// BUILDER ///////////////////////////
+
+static node_t *CNODE = NULL;
+
+static tag_t cur_tag(void){ return (tag_t)(CNODE - out_nodes); }
+
+static uint32_t intern_checked(const char *str, size_t size, const char *what){
+  if(strlen(str) >= size){ warn("%s is longer than the game shows (%zu characters)", what, size-1); }
+  return intern(str);
+}
+
+static void node_select(tag_t t){
+  CNODE = &out_nodes[t];
+}
+
+static void node_init(const char *label, node_type_t type){
+  char idstr[STR_SIZE_S];
+  tag_t tag = cur_tag();
+  CNODE->type = type;
+  nodes[tag].init_line = src_line;
+  format_idstr(idstr, nodes[tag].name);
+  if(strlen(idstr) >= IDSTR_SIZE){ fail("tag %s is too long; saves keep ids of up to %d characters", nodes[tag].name, IDSTR_SIZE-1); }
+  CNODE->idstr = intern(idstr);
+  out_texts[tag].label = intern_checked(label, STR_SIZE_S, "label");
+  if(CNODE->type == NT_ITEM || CNODE->type == NT_FLAG){
+    nodes[tag].rehidden_by = tag;
+  }
+}
+
+// Nodes without a custom asopt get one made from their label, once the whole
+// file is read, so overridden defaults never take up room in the arena.
+static void node_default_asopt(node_t *n, const char *label){
+  char asopt[STR_SIZE_M];
+  if(n->type == NT_ITEM){
+    snprintf(asopt, STR_SIZE_M, "Pick up the %s.", label);
+  }else if(n->type == NT_FLAG){
+    snprintf(asopt, STR_SIZE_M, "Pick up the %s.", label);
+  }else if(n->type == NT_ROOM){
+    snprintf(asopt, STR_SIZE_M, "Enter the %s.", label);
+  }else if(n->type == NT_PROP){
+    snprintf(asopt, STR_SIZE_M, "Look at %s.", label);
+  }else if(n->type == NT_LOCK){
+    snprintf(asopt, STR_SIZE_M, "Inspect the %s.", label);
+  }else if(n->type == NT_CASE){
+    snprintf(asopt, STR_SIZE_M, "Search the %s.", label);
+  }else if(n->type == NT_HALL){
+    snprintf(asopt, STR_SIZE_M, "Move to the %s.", label);
+  }else{
+    snprintf(asopt, STR_SIZE_M, "%s", label);
+  }
+  n->asopt = intern(asopt);
+}
+
+static void node_link(const tag_t *children){
+  for(size_t i=0;i<MAX_CHILDREN;i++){
+    CNODE->children[i] = children[i];
+    out_nodes[children[i]].parent = cur_tag();
+  }
+}
+
+static void node_add_as_child_to(tag_t p){
+  for(size_t i=0;i<MAX_CHILDREN;i++){
+    if(out_nodes[p].children[i] == TAG_NONE){
+      out_nodes[p].children[i] = cur_tag(); CNODE->parent = p;
+      return;
+    }
+  }
+  warn("child_of found no empty slot on %s", nodes[p].name);
+}
+
+static void node_desc(const char *title, const char *bgimg, const char *prose){
+  out_texts[cur_tag()].title = intern_checked(title, STR_SIZE_S, "title");
+  out_texts[cur_tag()].bgimg = intern_checked(bgimg, STR_SIZE_M, "bgimg");
+  out_texts[cur_tag()].prose = intern_checked(prose, STR_SIZE_L, "prose");
+}
+
+static void node_custom_asopt(const char *asopt){
+  CNODE->asopt = intern_checked(asopt, STR_SIZE_M, "asopt");
+  nodes[cur_tag()].custom_asopt = true;
+}
+
+///////////////////////////// PARSER ////////////////////////////
+
+typedef struct {
+  bool is_string;
+  char text[STR_SIZE_L];
+} token_t;
+
+static const char *cursor;
+
+// Reads the next word or string literal, or returns false at end of input.
+static bool next_token(token_t *tok){
+  for(;;){
+    while(isspace((unsigned char)*cursor)){ if(*cursor == '\n'){ src_line++; } cursor++; }
+    if(*cursor == '#'){ while(*cursor != '\0' && *cursor != '\n'){ cursor++; } continue; }
+    break;
+  }
+  if(*cursor == '\0'){ return false; }
+
+  size_t n = 0;
+  if(*cursor == '"'){
+    tok->is_string = true;
+    cursor++;
+    while(*cursor != '"'){
+      char c = *cursor++;
+      if(c == '\0' || c == '\n'){ fail("unterminated string"); }
+      if(c == '\\'){
+        c = *cursor++;
+        if(c == 'n'){ c = '\n'; }
+        else if(c == 't'){ c = '\t'; }
+        else if(c != '"' && c != '\\' && c != '\''){ fail("unknown escape \\%c", c); }
+      }
+      if(n == STR_SIZE_L-1){ fail("string too long"); }
+      tok->text[n++] = c;
+    }
+    cursor++;
+  }else{
+    tok->is_string = false;
+    while(*cursor != '\0' && !isspace((unsigned char)*cursor) && *cursor != '"' && *cursor != '#'){
+      if(n == STR_SIZE_L-1){ fail("word too long"); }
+      tok->text[n++] = *cursor++;
+    }
+  }
+  tok->text[n] = '\0';
+  return true;
+}
+
+static bool is_directive(const token_t *tok){
+  return !tok->is_string && islower((unsigned char)tok->text[0]);
+}
+
+static node_type_t parse_type(const token_t *tok){
+  static const char *names[] = { "NONE", "HALL", "ROOM", "PROP", "ITEM", "FLAG", "CASE", "LOCK" };
+  for(size_t i=0; i<sizeof(names)/sizeof(names[0]); i++){
+    if(!tok->is_string && strcmp(tok->text, names[i]) == 0){ return (node_type_t)i; }
+  }
+  fail("unknown node type: %s", tok->text);
+  return NT_NONE;
+}
+
+static tag_t parse_tag(const token_t *tok){
+  if(tok->is_string){ fail("expected a tag, found a string"); }
+  return tag_lookup(tok->text);
+}
+
+static void expect_args(const char *directive, int argc, int want){
+  if(argc != want){ fail("%s takes %d argument%s, found %d", directive, want, want == 1 ? "" : "s", argc); }
+}
+
+static void need_node(const char *directive){
+  if(CNODE == NULL){ fail("%s before any select", directive); }
+}
+
+static void run_directive(const char *d, token_t *args, int argc, int line){
+  int next_line = src_line;
+  src_line = line;
+
+  if(strcmp(d, "select") == 0){
+    expect_args(d, argc, 1);
+    node_select(parse_tag(&args[0]));
+  }else if(strcmp(d, "init") == 0){
+    need_node(d); expect_args(d, argc, 2);
+    if(!args[0].is_string){ fail("init expects a label string first"); }
+    if(nodes[cur_tag()].init_line != 0){ fail("%s was already given an init on line %d", nodes[cur_tag()].name, nodes[cur_tag()].init_line); }
+    node_init(args[0].text, parse_type(&args[1]));
+  }else if(strcmp(d, "desc") == 0){
+    need_node(d);
+    if(argc < 3){ fail("desc takes a title, a bgimg and prose"); }
+    static char prose[STR_SIZE_L*16];
+    prose[0] = '\0';
+    for(int i=0; i<argc; i++){
+      if(!args[i].is_string){ fail("desc arguments must be strings"); }
+      if(i >= 2 && strlen(prose) + strlen(args[i].text) < sizeof(prose)){ strcat(prose, args[i].text); }
+    }
+    node_desc(args[0].text, args[1].text, prose);
+  }else if(strcmp(d, "asopt") == 0){
+    need_node(d); expect_args(d, argc, 1);
+    if(!args[0].is_string){ fail("asopt expects a string"); }
+    if(nodes[cur_tag()].init_line == 0){ fail("asopt before init on %s", nodes[cur_tag()].name); }
+    node_custom_asopt(args[0].text);
+  }else if(strcmp(d, "link") == 0){
+    need_node(d); expect_args(d, argc, MAX_CHILDREN);
+    tag_t children[MAX_CHILDREN];
+    for(int i=0; i<MAX_CHILDREN; i++){ children[i] = parse_tag(&args[i]); }
+    node_link(children);
+  }else if(strcmp(d, "child_of") == 0){
+    need_node(d); expect_args(d, argc, 1);
+    node_add_as_child_to(parse_tag(&args[0]));
+  }else if(strcmp(d, "parent") == 0){
+    need_node(d); expect_args(d, argc, 1);
+    CNODE->parent = parse_tag(&args[0]);
+  }else if(strcmp(d, "revealed_by") == 0){
+    need_node(d); expect_args(d, argc, 1);
+    nodes[cur_tag()].revealed_by = parse_tag(&args[0]);
+  }else if(strcmp(d, "unlocked_by") == 0){
+    need_node(d); expect_args(d, argc, 1);
+    nodes[cur_tag()].unlocked_by = parse_tag(&args[0]);
+  }else if(strcmp(d, "rehidden_by") == 0){
+    need_node(d); expect_args(d, argc, 1);
+    nodes[cur_tag()].rehidden_by = parse_tag(&args[0]);
+  }else{
+    fail("unknown directive: %s", d);
+  }
+
+  src_line = next_line;
+}
+
+static void parse_world(const char *text){
+  static token_t args[MAX_ARGS];
+  token_t directive, tok;
+  int argc = 0;
+  int line = 0;
+  bool have_directive = false;
+
+  cursor = text;
+  src_line = 1;
+  while(next_token(&tok)){
+    if(is_directive(&tok)){
+      if(have_directive){ run_directive(directive.text, args, argc, line); }
+      directive = tok; argc = 0; line = src_line; have_directive = true;
+    }else{
+      if(!have_directive){ fail("expected a directive, found '%s'", tok.text); }
+      if(argc == MAX_ARGS){ fail("too many arguments to %s", directive.text); }
+      args[argc++] = tok;
+    }
+  }
+  if(have_directive){ run_directive(directive.text, args, argc, line); }
+}
+
+///////////////////////////// FLAGS /////////////////////////////
+
+static uint32_t flag_count = 1; // bit zero is FLAG_NONE
+
+static flag_t condition_flag(tag_t by, const char *what, tag_t t){
+  if(by == TAG_NONE){ return FLAG_NONE; }
+  if(out_nodes[by].flag == FLAG_NONE){
+    src_line = nodes[t].first_line;
+    fail("%s %s %s, which is not an ITEM or FLAG", nodes[t].name, what, nodes[by].name);
+  }
+  return out_nodes[by].flag;
+}
+
+// Numbers the items and flags in tag order, then turns every condition
+// into the bit it tests.
+static void assign_flags(void){
+  for(uint32_t i=0; i<node_count; i++){
+    if(out_nodes[i].type == NT_ITEM || out_nodes[i].type == NT_FLAG){
+      if(flag_count == MAX_TAGS){ fail("too many items and flags"); }
+      out_nodes[i].flag = flag_count++;
+    }
+  }
+  for(uint32_t i=0; i<node_count; i++){
+    out_nodes[i].revealed_by = condition_flag(nodes[i].revealed_by, "is revealed_by", i);
+    out_nodes[i].unlocked_by = condition_flag(nodes[i].unlocked_by, "is unlocked_by", i);
+    out_nodes[i].rehidden_by = condition_flag(nodes[i].rehidden_by, "is rehidden_by", i);
+  }
+}
+
+///////////////////////////// OUTPUT ////////////////////////////
+
+static int write_world(const char *fn){
+  world_header_t hdr;
+  memset(&hdr, 0, sizeof(hdr));
+  hdr.magic = WORLD_MAGIC;
+  hdr.version = WORLD_VERSION;
+  hdr.node_count = node_count;
+  hdr.flag_count = flag_count;
+  hdr.node_offset = sizeof(world_header_t);
+  hdr.text_offset = hdr.node_offset + node_count*sizeof(node_t);
+  hdr.string_offset = hdr.text_offset + node_count*sizeof(node_text_t);
+  hdr.string_size = pool_size;
+
+  FILE *fp = fopen(fn, "wb");
+  if(fp == NULL){ fprintf(stderr, "ERROR: Cannot write: %s\n", fn); return 0; }
+  fwrite(&hdr, sizeof(hdr), 1, fp);
+  fwrite(out_nodes, sizeof(node_t), node_count, fp);
+  fwrite(out_texts, sizeof(node_text_t), node_count, fp);
+  fwrite(pool, 1, pool_size, fp);
+  return fclose(fp) == 0;
+}
+
+int main(int argc, char *argv[]){
+  if(argc != 3){
+    fprintf(stderr, "usage: %s WORLD.world OUTPUT.wld\n", argv[0]);
+    return 1;
+  }
+
+  src_fn = argv[1];
+  FILE *fp = fopen(src_fn, "rb");
+  if(fp == NULL){ fprintf(stderr, "ERROR: Cannot open: %s\n", src_fn); return 1; }
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  char *text = malloc(size + 1);
+  if(fread(text, 1, size, fp) != (size_t)size){ fprintf(stderr, "ERROR: Cannot read: %s\n", src_fn); return 1; }
+  text[size] = '\0';
+  fclose(fp);
+
+  nodes = calloc(MAX_TAGS, sizeof(build_node_t));
+  out_nodes = calloc(MAX_TAGS, sizeof(node_t));
+  out_texts = calloc(MAX_TAGS, sizeof(node_text_t));
+  intern(""); // offset zero is the empty string, so unset fields read as ""
+  tag_lookup("TAG_NONE"); // the root always gets index zero
+
+  parse_world(text);
+
+  // Every tag that is referenced must also be defined somewhere.
+  int errors = 0;
+  for(uint32_t i=0; i<node_count; i++){
+    if(nodes[i].init_line == 0){
+      src_line = nodes[i].first_line;
+      fprintf(stderr, "%s:%d: error: %s is never given an init\n", src_fn, src_line, nodes[i].name);
+      errors++;
+    }
+  }
+  if(errors > 0){ return 1; }
+
+  assign_flags();
+
+  for(uint32_t i=0; i<node_count; i++){
+    if(!nodes[i].custom_asopt){
+      char label[STR_SIZE_S];
+      snprintf(label, STR_SIZE_S, "%s", &pool[out_texts[i].label]);
+      node_default_asopt(&out_nodes[i], label);
+    }
+  }
+
+  if(!write_world(argv[2])){ return 1; }
+  printf("worldc: %u nodes, %u flags, %u bytes of strings -> %s\n", node_count, flag_count-1, pool_size, argv[2]);
+  return 0;
+}